@@ -0,0 +1,411 @@
+/*****************************************************************************
+ * \file
+ * \brief Contention benchmark comparing the throughput and fairness of every
+ *        lock in the library.
+ *
+ * Each run starts a number of threads that repeatedly acquire one shared
+ * lock, perform a critical section of a given length, release it, and then
+ * perform a fixed amount of work of their own. A run is described by the
+ * lock, the thread count, the critical-section length and, for locks with a
+ * shared mode, the percentage of acquisitions that are writes.
+ *
+ * Results are written as CSV, one row per run:
+ *
+ *   lock,threads,critical_section,write_percent,duration_s,operations,
+ *   ops_per_sec,min_thread_ops,max_thread_ops,jain_fairness
+ *
+ * where jain_fairness is Jain's index over the per-thread operation counts;
+ * 1 is perfectly fair, and 1/threads means one thread did all the work.
+ *
+ * Usage:
+ *
+ *   bit_concurrency_benchmark [--output FILE] [--duration-ms N]
+ *                             [--threads N,N,...] [--critical-sections N,...]
+ *                             [--write-percents N,...] [--think N]
+ *                             [--locks NAME,NAME,...]
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/adaptive_mutex.hpp>
+#include <bit/concurrency/locks/clh_lock.hpp>
+#include <bit/concurrency/locks/distributed_shared_mutex.hpp>
+#include <bit/concurrency/locks/latch.hpp>
+#include <bit/concurrency/locks/mcs_lock.hpp>
+#include <bit/concurrency/locks/semaphore.hpp>
+#include <bit/concurrency/locks/shared_mutex.hpp>
+#include <bit/concurrency/locks/spin_lock.hpp>
+#include <bit/concurrency/locks/spinning_semaphore.hpp>
+#include <bit/concurrency/locks/ticket_lock.hpp>
+
+#include <bit/concurrency/utilities/cache_aligned.hpp>
+
+#include <algorithm>   // std::min_element, std::max_element, std::find
+#include <atomic>      // std::atomic
+#include <chrono>      // std::chrono::steady_clock
+#include <cstdint>     // std::uint64_t, std::uint32_t
+#include <cstdlib>     // std::strtoul, EXIT_SUCCESS, EXIT_FAILURE
+#include <fstream>     // std::ofstream
+#include <iostream>    // std::cout, std::cerr
+#include <mutex>       // std::mutex
+#include <sstream>     // std::istringstream
+#include <string>      // std::string
+#include <thread>      // std::thread
+#include <type_traits> // std::integral_constant
+#include <utility>     // std::move
+#include <vector>      // std::vector
+
+namespace {
+
+  //--------------------------------------------------------------------------
+  // Configuration
+  //--------------------------------------------------------------------------
+
+  struct options
+  {
+    std::string                output;
+    std::chrono::milliseconds  duration{100};
+    std::vector<unsigned>      threads;
+    std::vector<unsigned>      critical_sections{0, 64, 512};
+    std::vector<unsigned>      write_percents{100, 50, 10};
+    unsigned                   think = 32;
+    std::vector<std::string>   locks;
+  };
+
+  struct run_result
+  {
+    std::vector<std::uint64_t> thread_ops;
+    double                     seconds;
+  };
+
+  //--------------------------------------------------------------------------
+  // Workload
+  //--------------------------------------------------------------------------
+
+  /// The data guarded by the lock under test
+  struct shared_data
+  {
+    std::uint64_t values[8];
+  };
+
+  /// Prevents the compiler from discarding work whose result is unused
+  std::atomic<std::uint64_t> g_sink{0};
+
+  void write_section( shared_data& data, unsigned length ) noexcept
+  {
+    for( auto i = 0u; i < length; ++i ) {
+      ++data.values[i & 7];
+    }
+  }
+
+  std::uint64_t read_section( const shared_data& data, unsigned length ) noexcept
+  {
+    auto sum = std::uint64_t(0);
+    for( auto i = 0u; i < length; ++i ) {
+      sum += data.values[i & 7];
+    }
+    return sum;
+  }
+
+  std::uint64_t think( std::uint64_t seed, unsigned length ) noexcept
+  {
+    for( auto i = 0u; i < length; ++i ) {
+      seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+    }
+    return seed;
+  }
+
+  std::uint32_t next_random( std::uint32_t& state ) noexcept
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+
+  //--------------------------------------------------------------------------
+  // Lock Adapters
+  //--------------------------------------------------------------------------
+
+  /// Adapts a semaphore with a count of one to the Lockable interface
+  template<typename Semaphore>
+  class binary_semaphore_lock
+  {
+  public:
+    binary_semaphore_lock() : m_semaphore(1){}
+
+    void lock(){ m_semaphore.wait(); }
+    void unlock(){ m_semaphore.signal(); }
+
+  private:
+    Semaphore m_semaphore;
+  };
+
+  /// \brief Performs one operation under \p lock, exclusively if \p write
+  ///        is set or the lock has no shared mode
+  ///
+  /// \return a value derived from the data read, if any
+  template<typename Lock>
+  std::uint64_t operate( Lock& lock, shared_data& data, unsigned length,
+                         bool write, std::true_type )
+  {
+    if( write ) {
+      lock.lock();
+      write_section( data, length );
+      lock.unlock();
+      return 0;
+    }
+
+    lock.lock_shared();
+    const auto sum = read_section( data, length );
+    lock.unlock_shared();
+    return sum;
+  }
+
+  template<typename Lock>
+  std::uint64_t operate( Lock& lock, shared_data& data, unsigned length,
+                         bool, std::false_type )
+  {
+    lock.lock();
+    write_section( data, length );
+    lock.unlock();
+    return 0;
+  }
+
+  //--------------------------------------------------------------------------
+  // Runs
+  //--------------------------------------------------------------------------
+
+  /// \brief Runs one configuration against a fresh \c Lock
+  ///
+  /// \tparam Shared whether reads take the lock in shared mode
+  template<typename Lock, bool Shared>
+  run_result run( const options& opts,
+                  unsigned threads,
+                  unsigned critical_section,
+                  unsigned write_percent )
+  {
+    // Automatic rather than heap-allocated, so that the lock and the data
+    // really are on lines of their own before C++17
+    bit::concurrency::cache_aligned<Lock>        lock;
+    bit::concurrency::cache_aligned<shared_data> data;
+
+    std::atomic<bool> stop{false};
+    bit::concurrency::latch ready{ threads + 1 };
+    auto counts = std::vector<std::uint64_t>( threads, 0 );
+
+    auto workers = std::vector<std::thread>();
+    workers.reserve( threads );
+
+    for( auto t = 0u; t < threads; ++t ) {
+      workers.emplace_back( [&,t]{
+        auto random = static_cast<std::uint32_t>(t * 2654435761u + 1);
+        auto local  = std::uint64_t(t);
+        auto ops    = std::uint64_t(0);
+
+        ready.arrive_and_wait();
+
+        while( !stop.load(std::memory_order_relaxed) ) {
+          const auto write = (next_random(random) % 100) < write_percent;
+
+          local += operate( *lock, *data, critical_section, write,
+                            std::integral_constant<bool,Shared>{} );
+          local = think( local, opts.think );
+          ++ops;
+        }
+
+        counts[t] = ops;
+        g_sink.fetch_add(local, std::memory_order_relaxed);
+      } );
+    }
+
+    ready.arrive_and_wait();
+    const auto start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for( opts.duration );
+    stop.store(true, std::memory_order_relaxed);
+
+    for( auto& w : workers ) {
+      w.join();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    return run_result{
+      std::move(counts),
+      std::chrono::duration<double>(elapsed).count()
+    };
+  }
+
+  void write_row( std::ostream& out,
+                  const std::string& lock,
+                  unsigned threads,
+                  unsigned critical_section,
+                  unsigned write_percent,
+                  const run_result& result )
+  {
+    auto total  = std::uint64_t(0);
+    auto square = 0.0;
+    for( auto ops : result.thread_ops ) {
+      total  += ops;
+      square += static_cast<double>(ops) * static_cast<double>(ops);
+    }
+
+    const auto min = *std::min_element( result.thread_ops.begin(), result.thread_ops.end() );
+    const auto max = *std::max_element( result.thread_ops.begin(), result.thread_ops.end() );
+    const auto jain = (square == 0.0)
+      ? 0.0
+      : (static_cast<double>(total) * static_cast<double>(total))
+          / (static_cast<double>(threads) * square);
+
+    out << lock << ','
+        << threads << ','
+        << critical_section << ','
+        << write_percent << ','
+        << result.seconds << ','
+        << total << ','
+        << static_cast<double>(total) / result.seconds << ','
+        << min << ','
+        << max << ','
+        << jain << '\n';
+    out.flush();
+  }
+
+  /// \brief Sweeps every configuration of \c Lock
+  template<typename Lock, bool Shared>
+  void sweep( const options& opts, const std::string& name, std::ostream& out )
+  {
+    if( !opts.locks.empty() &&
+        std::find( opts.locks.begin(), opts.locks.end(), name ) == opts.locks.end() ) {
+      return;
+    }
+
+    const auto exclusive_only = std::vector<unsigned>{ 100 };
+    const auto& write_percents = Shared ? opts.write_percents : exclusive_only;
+
+    for( auto threads : opts.threads ) {
+      for( auto critical_section : opts.critical_sections ) {
+        for( auto write_percent : write_percents ) {
+          const auto result = run<Lock,Shared>( opts, threads, critical_section, write_percent );
+          write_row( out, name, threads, critical_section, write_percent, result );
+        }
+      }
+    }
+  }
+
+  //--------------------------------------------------------------------------
+  // Command Line
+  //--------------------------------------------------------------------------
+
+  std::vector<std::string> split( const std::string& list )
+  {
+    auto result = std::vector<std::string>();
+    auto stream = std::istringstream( list );
+    auto item   = std::string();
+
+    while( std::getline( stream, item, ',' ) ) {
+      if( !item.empty() ) result.push_back( item );
+    }
+    return result;
+  }
+
+  std::vector<unsigned> split_unsigned( const std::string& list )
+  {
+    auto result = std::vector<unsigned>();
+
+    for( const auto& item : split( list ) ) {
+      result.push_back( static_cast<unsigned>(std::strtoul( item.c_str(), nullptr, 10 )) );
+    }
+    return result;
+  }
+
+  std::vector<unsigned> default_thread_counts()
+  {
+    // Powers of two up to twice the hardware threads, to include the
+    // oversubscribed case
+    const auto hardware = std::max( 1u, std::thread::hardware_concurrency() );
+    auto result = std::vector<unsigned>();
+
+    for( auto n = 1u; n <= 2 * hardware; n *= 2 ) {
+      result.push_back( n );
+    }
+    return result;
+  }
+
+  bool parse( int argc, char** argv, options& opts )
+  {
+    for( auto i = 1; i < argc; ++i ) {
+      const auto arg = std::string( argv[i] );
+
+      if( arg == "--help" || i + 1 == argc ) {
+        return false;
+      }
+
+      const auto value = std::string( argv[++i] );
+
+      if( arg == "--output" ) {
+        opts.output = value;
+      } else if( arg == "--duration-ms" ) {
+        opts.duration = std::chrono::milliseconds( std::strtoul( value.c_str(), nullptr, 10 ) );
+      } else if( arg == "--threads" ) {
+        opts.threads = split_unsigned( value );
+      } else if( arg == "--critical-sections" ) {
+        opts.critical_sections = split_unsigned( value );
+      } else if( arg == "--write-percents" ) {
+        opts.write_percents = split_unsigned( value );
+      } else if( arg == "--think" ) {
+        opts.think = static_cast<unsigned>(std::strtoul( value.c_str(), nullptr, 10 ));
+      } else if( arg == "--locks" ) {
+        opts.locks = split( value );
+      } else {
+        return false;
+      }
+    }
+
+    if( opts.threads.empty() ) {
+      opts.threads = default_thread_counts();
+    }
+    return std::find( opts.threads.begin(), opts.threads.end(), 0u ) == opts.threads.end();
+  }
+
+} // anonymous namespace
+
+int main( int argc, char** argv )
+{
+  namespace bc = bit::concurrency;
+
+  auto opts = options();
+
+  if( !parse( argc, argv, opts ) ) {
+    std::cerr << "usage: " << argv[0]
+              << " [--output FILE] [--duration-ms N] [--threads N,...]"
+                 " [--critical-sections N,...] [--write-percents N,...]"
+                 " [--think N] [--locks NAME,...]\n";
+    return EXIT_FAILURE;
+  }
+
+  auto file = std::ofstream();
+  if( !opts.output.empty() ) {
+    file.open( opts.output );
+    if( !file ) {
+      std::cerr << "unable to open '" << opts.output << "'\n";
+      return EXIT_FAILURE;
+    }
+  }
+  auto& out = opts.output.empty() ? std::cout : static_cast<std::ostream&>(file);
+
+  out << "lock,threads,critical_section,write_percent,duration_s,operations,"
+         "ops_per_sec,min_thread_ops,max_thread_ops,jain_fairness\n";
+
+  // Exclusive locks
+  sweep<std::mutex,false>( opts, "std::mutex", out );
+  sweep<bc::spin_lock,false>( opts, "spin_lock", out );
+  sweep<bc::ticket_lock,false>( opts, "ticket_lock", out );
+  sweep<bc::mcs_lock,false>( opts, "mcs_lock", out );
+  sweep<bc::clh_lock,false>( opts, "clh_lock", out );
+  sweep<bc::adaptive_mutex,false>( opts, "adaptive_mutex", out );
+  sweep<binary_semaphore_lock<bc::semaphore>,false>( opts, "semaphore", out );
+  sweep<binary_semaphore_lock<bc::spinning_semaphore>,false>( opts, "spinning_semaphore", out );
+
+  // Shared locks
+  sweep<bc::shared_mutex,true>( opts, "shared_mutex", out );
+  sweep<bc::distributed_shared_mutex,true>( opts, "distributed_shared_mutex", out );
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,445 @@
+/*****************************************************************************
+ * \file
+ * \brief Wake-up latency benchmark for the blocking primitives.
+ *
+ * Two threads ping-pong through a pair of primitives. The pinging thread
+ * timestamps each signal(), and the ponging thread records how long after it
+ * its wait() returned. The ponging thread raises a flag immediately before
+ * each wait(), and the pinging thread does not signal until it has seen the
+ * flag, so the time measured is the wake-up alone.
+ *
+ * Each run pins the two threads according to a placement:
+ *
+ *   same_cpu      both threads on one logical CPU
+ *   smt_sibling   two hardware threads of one core
+ *   same_socket   two cores of one package
+ *   cross_socket  two packages
+ *   unpinned      left to the scheduler
+ *
+ * Placements the machine cannot provide are skipped. Pinning and topology
+ * discovery are only available on Linux; elsewhere only 'unpinned' is run.
+ *
+ * A delay between the ponging thread beginning to wait and the signal
+ * separates the two halves of a spinning primitive: with no delay its wait
+ * ends within the spin phase, and with a delay longer than its spin budget
+ * it parks in the kernel and is woken from there. semaphore always parks,
+ * so comparing it against spinning_semaphore at each delay shows which
+ * half the tail comes from.
+ *
+ * Results are written as CSV, one row per run:
+ *
+ *   primitive,placement,cpu_a,cpu_b,delay_us,samples,min_ns,p50_ns,p99_ns,
+ *   p999_ns,max_ns
+ *
+ * Usage:
+ *
+ *   bit_concurrency_wake_latency [--output FILE] [--samples N]
+ *                                [--delays-us N,N,...]
+ *                                [--placements NAME,NAME,...]
+ *                                [--primitives NAME,NAME,...]
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/semaphore.hpp>
+#include <bit/concurrency/locks/spinning_semaphore.hpp>
+#include <bit/concurrency/locks/waitable_event.hpp>
+
+#include <algorithm>   // std::sort, std::find
+#include <atomic>      // std::atomic
+#include <chrono>      // std::chrono::steady_clock
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int64_t
+#include <cstdlib>     // std::strtoul, EXIT_SUCCESS, EXIT_FAILURE
+#include <fstream>     // std::ofstream, std::ifstream
+#include <iostream>    // std::cout, std::cerr
+#include <memory>      // std::unique_ptr
+#include <sstream>     // std::istringstream
+#include <string>      // std::string
+#include <thread>      // std::thread, std::this_thread
+#include <vector>      // std::vector
+
+#if defined(__linux__)
+# include <pthread.h>
+# include <sched.h>
+#endif
+
+namespace {
+
+  //--------------------------------------------------------------------------
+  // Configuration
+  //--------------------------------------------------------------------------
+
+  struct options
+  {
+    std::string              output;
+    std::size_t              samples = 10000;
+    std::vector<unsigned>    delays_us{0, 200};
+    std::vector<std::string> placements;
+    std::vector<std::string> primitives;
+  };
+
+  /// Two CPUs to pin the pinging and ponging threads to; -1 leaves a thread
+  /// unpinned
+  struct placement
+  {
+    std::string name;
+    int         cpu_a;
+    int         cpu_b;
+  };
+
+  bool selected( const std::vector<std::string>& filter, const std::string& name )
+  {
+    return filter.empty() || std::find( filter.begin(), filter.end(), name ) != filter.end();
+  }
+
+  //--------------------------------------------------------------------------
+  // Topology
+  //--------------------------------------------------------------------------
+
+#if defined(__linux__)
+
+  struct cpu_topology
+  {
+    int cpu;
+    int package;
+    int core;
+  };
+
+  int read_topology( int cpu, const char* name )
+  {
+    auto path = std::string("/sys/devices/system/cpu/cpu") + std::to_string(cpu)
+              + "/topology/" + name;
+    auto file = std::ifstream( path );
+    auto value = -1;
+
+    file >> value;
+    return value;
+  }
+
+  /// \brief Lists the CPUs this process may run on
+  std::vector<cpu_topology> available_cpus()
+  {
+    auto set = cpu_set_t();
+    auto result = std::vector<cpu_topology>();
+
+    CPU_ZERO(&set);
+    if( ::sched_getaffinity( 0, sizeof(set), &set ) != 0 ) {
+      return result;
+    }
+
+    for( auto cpu = 0; cpu < CPU_SETSIZE; ++cpu ) {
+      if( CPU_ISSET(cpu, &set) ) {
+        result.push_back( cpu_topology{
+          cpu,
+          read_topology( cpu, "physical_package_id" ),
+          read_topology( cpu, "core_id" )
+        } );
+      }
+    }
+    return result;
+  }
+
+  std::vector<placement> discover_placements()
+  {
+    const auto cpus = available_cpus();
+    auto result = std::vector<placement>();
+
+    if( !cpus.empty() ) {
+      const auto& first = cpus.front();
+      auto sibling = -1;
+      auto same_socket = -1;
+      auto cross_socket = -1;
+
+      for( auto i = std::size_t(1); i < cpus.size(); ++i ) {
+        const auto& other = cpus[i];
+
+        if( other.package != first.package ) {
+          if( cross_socket < 0 ) cross_socket = other.cpu;
+        } else if( other.core == first.core ) {
+          if( sibling < 0 ) sibling = other.cpu;
+        } else {
+          if( same_socket < 0 ) same_socket = other.cpu;
+        }
+      }
+
+      result.push_back( placement{ "same_cpu", first.cpu, first.cpu } );
+      if( sibling >= 0 ) {
+        result.push_back( placement{ "smt_sibling", first.cpu, sibling } );
+      }
+      if( same_socket >= 0 ) {
+        result.push_back( placement{ "same_socket", first.cpu, same_socket } );
+      }
+      if( cross_socket >= 0 ) {
+        result.push_back( placement{ "cross_socket", first.cpu, cross_socket } );
+      }
+    }
+    result.push_back( placement{ "unpinned", -1, -1 } );
+
+    return result;
+  }
+
+  bool pin( std::thread& thread, int cpu )
+  {
+    if( cpu < 0 ) return true;
+
+    auto set = cpu_set_t();
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+
+    return ::pthread_setaffinity_np( thread.native_handle(), sizeof(set), &set ) == 0;
+  }
+
+#else
+
+  std::vector<placement> discover_placements()
+  {
+    return { placement{ "unpinned", -1, -1 } };
+  }
+
+  bool pin( std::thread&, int cpu )
+  {
+    return cpu < 0;
+  }
+
+#endif
+
+  //--------------------------------------------------------------------------
+  // Primitive Adapters
+  //--------------------------------------------------------------------------
+
+  /// A semaphore that starts with no count
+  template<typename Semaphore>
+  struct empty_semaphore
+  {
+    empty_semaphore() : semaphore(0){}
+
+    void wait(){ semaphore.wait(); }
+    void signal(){ semaphore.signal(); }
+
+    Semaphore semaphore;
+  };
+
+  /// An automatically resetting event, so each signal releases one wait
+  struct auto_reset_event
+  {
+    auto_reset_event()
+      : event(bit::concurrency::waitable_event::reset_mode::automatic){}
+
+    void wait(){ event.wait(); }
+    void signal(){ event.signal(); }
+
+    bit::concurrency::waitable_event event;
+  };
+
+  //--------------------------------------------------------------------------
+  // Runs
+  //--------------------------------------------------------------------------
+
+  using clock = std::chrono::steady_clock;
+
+  std::int64_t now_ns() noexcept
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      clock::now().time_since_epoch()
+    ).count();
+  }
+
+  /// \brief Measures \p samples wake-ups of a \c Primitive
+  ///
+  /// \return the wake-up latencies in nanoseconds, or nothing if the threads
+  ///         could not be pinned
+  template<typename Primitive>
+  std::vector<std::int64_t> run( const placement& where,
+                                 std::size_t samples,
+                                 std::chrono::microseconds delay )
+  {
+    // 'ping' wakes the ponging thread, and 'pong' tells the pinging thread
+    // that it is about to wait again
+    auto ping = std::unique_ptr<Primitive>( new Primitive() );
+    auto pong = std::unique_ptr<Primitive>( new Primitive() );
+    auto latencies = std::vector<std::int64_t>( samples );
+
+    std::atomic<std::int64_t> signaled_at{0};
+    std::atomic<bool> waiting{false}; ///< set just before each 'ping->wait()'
+    std::atomic<int> pinned{0};
+
+    // Each thread pins itself before its first wait, and neither starts
+    // until both have been pinned or have failed to be
+    auto ponger = std::thread( [&]{
+      while( pinned.load(std::memory_order_acquire) == 0 ) {
+        std::this_thread::yield();
+      }
+      if( pinned.load(std::memory_order_relaxed) < 0 ) return;
+
+      for( auto i = std::size_t(0); i < samples; ++i ) {
+        pong->signal();
+        waiting.store(true, std::memory_order_release);
+        ping->wait();
+        latencies[i] = now_ns() - signaled_at.load(std::memory_order_relaxed);
+      }
+    } );
+    auto pinger = std::thread( [&]{
+      while( pinned.load(std::memory_order_acquire) == 0 ) {
+        std::this_thread::yield();
+      }
+      if( pinned.load(std::memory_order_relaxed) < 0 ) return;
+
+      for( auto i = std::size_t(0); i < samples; ++i ) {
+        pong->wait();
+
+        // Yielding, rather than spinning, lets the ponging thread run when
+        // both threads share a CPU
+        while( !waiting.exchange(false, std::memory_order_acquire) ) {
+          std::this_thread::yield();
+        }
+
+        if( delay.count() > 0 ) {
+          std::this_thread::sleep_for( delay );
+        }
+
+        signaled_at.store(now_ns(), std::memory_order_relaxed);
+        ping->signal();
+      }
+    } );
+
+    const auto ok = pin( pinger, where.cpu_a ) && pin( ponger, where.cpu_b );
+    pinned.store(ok ? 1 : -1, std::memory_order_release);
+
+    pinger.join();
+    ponger.join();
+
+    if( !ok ) latencies.clear();
+    return latencies;
+  }
+
+  std::int64_t percentile( const std::vector<std::int64_t>& sorted, double p )
+  {
+    // Nearest rank
+    auto rank = static_cast<std::size_t>(p * static_cast<double>(sorted.size()));
+    if( rank >= sorted.size() ) rank = sorted.size() - 1;
+
+    return sorted[rank];
+  }
+
+  template<typename Primitive>
+  void sweep( const options& opts,
+              const std::vector<placement>& placements,
+              const std::string& name,
+              std::ostream& out )
+  {
+    if( !selected( opts.primitives, name ) ) return;
+
+    for( const auto& where : placements ) {
+      for( auto delay : opts.delays_us ) {
+        auto latencies = run<Primitive>( where, opts.samples, std::chrono::microseconds(delay) );
+
+        if( latencies.empty() ) {
+          std::cerr << "skipping " << name << " on " << where.name
+                    << ": unable to pin threads\n";
+          continue;
+        }
+        std::sort( latencies.begin(), latencies.end() );
+
+        out << name << ','
+            << where.name << ','
+            << where.cpu_a << ','
+            << where.cpu_b << ','
+            << delay << ','
+            << latencies.size() << ','
+            << latencies.front() << ','
+            << percentile( latencies, 0.5 ) << ','
+            << percentile( latencies, 0.99 ) << ','
+            << percentile( latencies, 0.999 ) << ','
+            << latencies.back() << '\n';
+        out.flush();
+      }
+    }
+  }
+
+  //--------------------------------------------------------------------------
+  // Command Line
+  //--------------------------------------------------------------------------
+
+  std::vector<std::string> split( const std::string& list )
+  {
+    auto result = std::vector<std::string>();
+    auto stream = std::istringstream( list );
+    auto item   = std::string();
+
+    while( std::getline( stream, item, ',' ) ) {
+      if( !item.empty() ) result.push_back( item );
+    }
+    return result;
+  }
+
+  bool parse( int argc, char** argv, options& opts )
+  {
+    for( auto i = 1; i < argc; ++i ) {
+      const auto arg = std::string( argv[i] );
+
+      if( arg == "--help" || i + 1 == argc ) {
+        return false;
+      }
+
+      const auto value = std::string( argv[++i] );
+
+      if( arg == "--output" ) {
+        opts.output = value;
+      } else if( arg == "--samples" ) {
+        opts.samples = std::strtoul( value.c_str(), nullptr, 10 );
+      } else if( arg == "--delays-us" ) {
+        opts.delays_us.clear();
+        for( const auto& item : split( value ) ) {
+          opts.delays_us.push_back( static_cast<unsigned>(std::strtoul( item.c_str(), nullptr, 10 )) );
+        }
+      } else if( arg == "--placements" ) {
+        opts.placements = split( value );
+      } else if( arg == "--primitives" ) {
+        opts.primitives = split( value );
+      } else {
+        return false;
+      }
+    }
+    return opts.samples > 0;
+  }
+
+} // anonymous namespace
+
+int main( int argc, char** argv )
+{
+  namespace bc = bit::concurrency;
+
+  auto opts = options();
+
+  if( !parse( argc, argv, opts ) ) {
+    std::cerr << "usage: " << argv[0]
+              << " [--output FILE] [--samples N] [--delays-us N,...]"
+                 " [--placements NAME,...] [--primitives NAME,...]\n";
+    return EXIT_FAILURE;
+  }
+
+  auto file = std::ofstream();
+  if( !opts.output.empty() ) {
+    file.open( opts.output );
+    if( !file ) {
+      std::cerr << "unable to open '" << opts.output << "'\n";
+      return EXIT_FAILURE;
+    }
+  }
+  auto& out = opts.output.empty() ? std::cout : static_cast<std::ostream&>(file);
+
+  auto placements = std::vector<placement>();
+  for( const auto& where : discover_placements() ) {
+    if( selected( opts.placements, where.name ) ) {
+      placements.push_back( where );
+    }
+  }
+
+  out << "primitive,placement,cpu_a,cpu_b,delay_us,samples,min_ns,p50_ns,"
+         "p99_ns,p999_ns,max_ns\n";
+
+  sweep<empty_semaphore<bc::semaphore>>( opts, placements, "semaphore", out );
+  sweep<empty_semaphore<bc::spinning_semaphore>>( opts, placements, "spinning_semaphore", out );
+  sweep<auto_reset_event>( opts, placements, "waitable_event", out );
+
+  return EXIT_SUCCESS;
+}
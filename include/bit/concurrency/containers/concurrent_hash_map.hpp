@@ -0,0 +1,359 @@
+/**
+ * \file concurrent_hash_map.hpp
+ *
+ * \brief This header contains an unordered map with lock-free lookups and
+ *        striped writes
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_CONTAINERS_CONCURRENT_HASH_MAP_HPP
+#define BIT_CONCURRENCY_CONTAINERS_CONCURRENT_HASH_MAP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../locks/spin_lock.hpp"
+
+#include "../memory/epoch_domain.hpp"
+
+#include "../utilities/cache_aligned.hpp"
+
+#include <atomic>     // std::atomic
+#include <cstddef>    // std::size_t
+#include <functional> // std::hash, std::equal_to
+#include <memory>     // std::unique_ptr
+#include <utility>    // std::pair
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief An unordered map for many concurrent readers, whose lookups
+    ///        take no lock
+    ///
+    /// Each bucket is a singly-linked chain of nodes. Lookups walk the
+    /// chain inside a critical region of the calling thread's participant
+    /// in epoch_domain::global(), so they never write to shared state, and
+    /// nodes that writers unlink are freed only once no lookup can still
+    /// be reading them.
+    ///
+    /// Writers lock one of \p Stripes padded locks, chosen by the low bits
+    /// of the key's hash. Tables always have at least \p Stripes buckets,
+    /// so every bucket, before and after a resize, is guarded by a single
+    /// stripe. Each stripe also counts the keys it guards, and a writer
+    /// that finds its stripe above one key per bucket starts a resize.
+    ///
+    /// Resizing is incremental: a table of twice the size is installed
+    /// beside the current one, and every later write migrates a fixed
+    /// chunk of buckets before it returns. A migrated bucket is replaced
+    /// with a forwarding marker, which sends lookups and writes to the
+    /// larger table. Migration copies only the links of a chain, so keys
+    /// and values are never copied or moved, and lookups that were already
+    /// walking the old chain still see all of it.
+    ///
+    /// Values are never modified in place: insert_or_assign replaces the
+    /// node, so a lookup sees either the old value or the new one. Removed
+    /// values are destroyed later, by whichever thread collects them.
+    ///
+    /// \tparam Key the key type
+    /// \tparam T the mapped type
+    /// \tparam Hash the hash of \p Key
+    /// \tparam KeyEqual the equality of \p Key
+    /// \tparam Mutex the lock of each stripe
+    /// \tparam Stripes the number of stripes; a power of two
+    //////////////////////////////////////////////////////////////////////////
+    template<typename Key,
+             typename T,
+             typename Hash = std::hash<Key>,
+             typename KeyEqual = std::equal_to<Key>,
+             typename Mutex = spin_lock,
+             std::size_t Stripes = 64>
+    class concurrent_hash_map
+    {
+      static_assert( Stripes > 0 && (Stripes & (Stripes - 1)) == 0,
+                     "concurrent_hash_map requires a power of two stripes" );
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using key_type    = Key;
+      using mapped_type = T;
+      using value_type  = std::pair<const Key,T>;
+      using size_type   = std::size_t;
+      using hasher      = Hash;
+      using key_equal   = KeyEqual;
+      using mutex_type  = Mutex;
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty concurrent_hash_map
+      ///
+      /// \param bucket_count the initial number of buckets, rounded up to a
+      ///        power of two no less than \p Stripes
+      /// \param hash the hash function
+      /// \param equal the key equality
+      explicit concurrent_hash_map( size_type bucket_count = Stripes,
+                                    const Hash& hash = Hash(),
+                                    const KeyEqual& equal = KeyEqual() );
+
+      // Deleted copy constructor
+      concurrent_hash_map( const concurrent_hash_map& ) = delete;
+
+      // Deleted move constructor
+      concurrent_hash_map( concurrent_hash_map&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Destroys every key and value still in the map
+      ///
+      /// No other thread may be using the map.
+      ~concurrent_hash_map();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      concurrent_hash_map& operator=( const concurrent_hash_map& ) = delete;
+
+      // Deleted move assignment
+      concurrent_hash_map& operator=( concurrent_hash_map&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Lookup
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Copies the value of \p key into \p value
+      ///
+      /// \param key the key to look up
+      /// \param value the value to assign to
+      /// \return \c true if \p key was found
+      bool find( const Key& key, T& value ) const;
+
+      /// \brief Returns whether the map contains \p key
+      ///
+      /// \param key the key to look up
+      /// \return \c true if \p key was found
+      bool contains( const Key& key ) const;
+
+      /// \brief Invokes \p fn with the value of \p key, without copying it
+      ///
+      /// \p fn runs inside the critical region, so the value stays alive
+      /// for the duration of the call even if another thread removes it.
+      ///
+      /// \param key the key to look up
+      /// \param fn the function to invoke with a \c const T&
+      /// \return \c true if \p key was found
+      template<typename Fn>
+      bool visit( const Key& key, Fn&& fn ) const;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Inserts \p value for \p key, if \p key is not present
+      ///
+      /// \param key the key
+      /// \param value the value
+      /// \return \c true if the value was inserted
+      bool insert( const Key& key, const T& value );
+      bool insert( const Key& key, T&& value );
+
+      /// \brief Constructs a value from \p args for \p key, if \p key is not
+      ///        present
+      ///
+      /// The value is constructed before the stripe is locked, so it is
+      /// constructed, and discarded, even when \p key is present.
+      ///
+      /// \param key the key
+      /// \param args the arguments to forward to the value's constructor
+      /// \return \c true if the value was inserted
+      template<typename...Args>
+      bool emplace( const Key& key, Args&&...args );
+
+      /// \brief Inserts \p value for \p key, replacing any current value
+      ///
+      /// \param key the key
+      /// \param value the value
+      /// \return \c true if the value was inserted, \c false if it replaced
+      ///         another
+      template<typename U>
+      bool insert_or_assign( const Key& key, U&& value );
+
+      /// \brief Removes \p key
+      ///
+      /// \param key the key to remove
+      /// \return \c true if \p key was removed
+      bool erase( const Key& key );
+
+      //----------------------------------------------------------------------
+      // Capacity
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns the number of keys
+      ///
+      /// The stripes are summed without locking them, so the result is
+      /// only exact while no writes are in progress.
+      ///
+      /// \return the number of keys
+      size_type size() const noexcept;
+
+      /// \brief Returns whether the map is empty
+      ///
+      /// \return \c true if size() is 0
+      bool empty() const noexcept;
+
+      /// \brief Returns the number of buckets of the current table
+      ///
+      /// \return the number of buckets
+      size_type bucket_count() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      struct entry
+      {
+        template<typename...Args>
+        explicit entry( const Key& key, Args&&...args );
+
+        value_type value;
+      };
+
+      /// \brief A link of a bucket's chain
+      ///
+      /// Links do not own their entry: after a migration, the retired link
+      /// of the old table and its copy in the new one share it.
+      struct link
+      {
+        link( std::size_t hash, entry* item, link* next ) noexcept;
+
+        std::atomic<link*> next;
+        std::size_t        hash; ///< the mixed hash of the key
+        entry*             item;
+      };
+
+      using bucket = std::atomic<link*>;
+
+      struct table
+      {
+        table( std::unique_ptr<bucket[]> buckets, size_type size ) noexcept;
+
+        std::unique_ptr<bucket[]> buckets;
+        size_type                 mask;     ///< the size, less one
+        std::atomic<table*>       next;     ///< the table being resized into
+        std::atomic<size_type>    claimed;  ///< buckets claimed for migration
+        std::atomic<size_type>    migrated; ///< buckets finished migrating
+      };
+
+      struct stripe
+      {
+        Mutex                  mutex;
+        std::atomic<size_type> count{0}; ///< keys guarded, written under 'mutex'
+      };
+
+      //----------------------------------------------------------------------
+      // Private Static Members
+      //----------------------------------------------------------------------
+    private:
+
+      /// The number of buckets each write migrates during a resize
+      static constexpr size_type migration_chunk = 16;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      Hash     m_hash;
+      KeyEqual m_equal;
+
+      /// Replaces the head of a bucket once it has been migrated; only its
+      /// address is used
+      link m_moved;
+
+      // Only written when a resize completes; read by every operation. The
+      // padding keeps the stripes, which every write touches, off of the
+      // lines read above
+      padded<std::atomic<table*>> m_table;
+
+      padded<stripe> m_stripes[Stripes];
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Mixes the bits of \p hash, so that the low bits that select
+      ///        a bucket and a stripe depend on all of them
+      static std::size_t mix( std::size_t hash ) noexcept;
+
+      /// \brief Rounds \p bucket_count up to a valid table size
+      static size_type round_size( size_type bucket_count ) noexcept;
+
+      /// \brief Deletes every link of the chain at \p head, with its entry
+      static void destroy_chain( link* head ) noexcept;
+
+      /// \brief Gets the stripe that guards keys with the mixed hash \p hash
+      stripe& stripe_for( std::size_t hash ) noexcept;
+
+      /// \brief Gets the head of the chain for \p hash, following
+      ///        forwarding markers
+      ///
+      /// Must be called inside a critical region.
+      link* head_for( std::size_t hash ) const noexcept;
+
+      /// \brief Gets the bucket for \p hash, following forwarding markers
+      ///
+      /// Must be called inside a critical region, with the stripe of
+      /// \p hash locked, which keeps the bucket from being migrated.
+      bucket& bucket_for( std::size_t hash ) noexcept;
+
+      /// \brief Finds the link of \p key in the chain at \p head
+      link* find_in( link* head, const Key& key, std::size_t hash ) const;
+
+      /// \brief Links \p l, whose key is not in the map, at the head of its
+      ///        bucket, and counts it against \p s
+      ///
+      /// \return the table to grow, or null if none needs to
+      table* link_new( stripe& s, bucket& b, link* l ) noexcept;
+
+      /// \brief Inserts the entry \p item, if its key is not present
+      bool insert_entry( std::unique_ptr<entry> item );
+
+      /// \brief Installs a table twice the size of \p t, unless a resize is
+      ///        already in progress or one cannot be allocated
+      void grow( table* t ) noexcept;
+
+      /// \brief Migrates the next chunk of buckets, if a resize is in
+      ///        progress
+      ///
+      /// Must be called inside a critical region of \p p, with no stripe
+      /// locked.
+      void help_resize( epoch_domain::participant& p );
+
+      /// \brief Copies the chain of bucket \p index of \p from into the two
+      ///        buckets of \p to that it splits into
+      ///
+      /// \return \c false if the copies could not be allocated, in which
+      ///         case the bucket is left where it is
+      bool migrate( table* from,
+                    table* to,
+                    size_type index,
+                    epoch_domain::participant& p );
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/concurrent_hash_map.inl"
+
+#endif /* BIT_CONCURRENCY_CONTAINERS_CONCURRENT_HASH_MAP_HPP */
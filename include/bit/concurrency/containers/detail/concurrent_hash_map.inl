@@ -0,0 +1,608 @@
+#ifndef BIT_CONCURRENCY_CONTAINERS_DETAIL_CONCURRENT_HASH_MAP_INL
+#define BIT_CONCURRENCY_CONTAINERS_DETAIL_CONCURRENT_HASH_MAP_INL
+
+#include <algorithm>        // std::min
+#include <cstdint>          // std::uint64_t
+#include <initializer_list> // std::initializer_list
+#include <limits>           // std::numeric_limits
+#include <mutex>            // std::lock_guard
+#include <new>              // std::nothrow
+#include <tuple>            // std::forward_as_tuple
+
+//----------------------------------------------------------------------------
+// Constructor / Destructor
+//----------------------------------------------------------------------------
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::concurrent_hash_map( size_type bucket_count,
+                         const Hash& hash,
+                         const KeyEqual& equal )
+  : m_hash(hash),
+    m_equal(equal),
+    m_moved(0, nullptr, nullptr),
+    m_table(nullptr),
+    m_stripes()
+{
+  const auto size = round_size( bucket_count );
+
+  m_table->store( new table( std::unique_ptr<bucket[]>(new bucket[size]()), size ),
+                  std::memory_order_relaxed );
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::~concurrent_hash_map()
+{
+  auto* t = m_table->load(std::memory_order_acquire);
+  auto* next = t->next.load(std::memory_order_acquire);
+
+  // Migrated buckets of 't' only hold the marker; their entries are owned by
+  // the copies in 'next'
+  for( auto* current : { t, next } ) {
+    if( current == nullptr ) continue;
+
+    for( auto i = size_type(0); i <= current->mask; ++i ) {
+      auto* head = current->buckets[i].load(std::memory_order_relaxed);
+
+      if( head != &m_moved ) {
+        destroy_chain( head );
+      }
+    }
+  }
+
+  delete next;
+  delete t;
+}
+
+//----------------------------------------------------------------------------
+// Lookup
+//----------------------------------------------------------------------------
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline bool bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::find( const Key& key, T& value )
+  const
+{
+  return visit( key, [&value]( const T& found ) {
+    value = found;
+  } );
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline bool bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::contains( const Key& key )
+  const
+{
+  return visit( key, []( const T& ){} );
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+template<typename Fn>
+inline bool bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::visit( const Key& key, Fn&& fn )
+  const
+{
+  const auto hash = mix( m_hash(key) );
+
+  epoch_domain::guard guard( epoch_domain::this_thread_participant() );
+
+  auto* l = find_in( head_for( hash ), key, hash );
+
+  if( l == nullptr ) return false;
+
+  const T& value = l->item->value.second;
+  fn( value );
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline bool bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::insert( const Key& key, const T& value )
+{
+  return emplace( key, value );
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline bool bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::insert( const Key& key, T&& value )
+{
+  return emplace( key, std::move(value) );
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+template<typename...Args>
+inline bool bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::emplace( const Key& key, Args&&...args )
+{
+  return insert_entry( std::unique_ptr<entry>(
+    new entry( key, std::forward<Args>(args)... )
+  ) );
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+template<typename U>
+inline bool bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::insert_or_assign( const Key& key, U&& value )
+{
+  const auto hash = mix( m_hash(key) );
+
+  // Both allocations happen before the stripe is locked, so that the lock
+  // is only held to relink
+  auto item = std::unique_ptr<entry>( new entry( key, std::forward<U>(value) ) );
+  auto l    = std::unique_ptr<link>( new link( hash, item.get(), nullptr ) );
+
+  auto& p = epoch_domain::this_thread_participant();
+  epoch_domain::guard guard(p);
+
+  auto& s = stripe_for( hash );
+  auto* replaced = static_cast<link*>(nullptr);
+  auto* grow_from = static_cast<table*>(nullptr);
+  {
+    std::lock_guard<Mutex> lock(s.mutex);
+
+    auto& b = bucket_for( hash );
+    auto* previous = &b;
+
+    for( auto* current = previous->load(std::memory_order_relaxed);
+         current != nullptr;
+         previous = &current->next,
+         current = current->next.load(std::memory_order_relaxed) ) {
+      if( current->hash == hash && m_equal( current->item->value.first, key ) ) {
+        replaced = current;
+        break;
+      }
+    }
+
+    if( replaced != nullptr ) {
+      l->next.store( replaced->next.load(std::memory_order_relaxed),
+                     std::memory_order_relaxed );
+      previous->store( l.get(), std::memory_order_release );
+    } else {
+      grow_from = link_new( s, b, l.get() );
+    }
+    l.release();
+    item.release();
+  }
+
+  if( replaced != nullptr ) {
+    p.retire( replaced->item );
+    p.retire( replaced );
+  } else if( grow_from != nullptr ) {
+    grow( grow_from );
+  }
+  help_resize( p );
+
+  return replaced == nullptr;
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline bool bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::erase( const Key& key )
+{
+  const auto hash = mix( m_hash(key) );
+
+  auto& p = epoch_domain::this_thread_participant();
+  epoch_domain::guard guard(p);
+
+  auto& s = stripe_for( hash );
+  auto* removed = static_cast<link*>(nullptr);
+  {
+    std::lock_guard<Mutex> lock(s.mutex);
+
+    auto* previous = &bucket_for( hash );
+
+    for( auto* current = previous->load(std::memory_order_relaxed);
+         current != nullptr;
+         previous = &current->next,
+         current = current->next.load(std::memory_order_relaxed) ) {
+      if( current->hash == hash && m_equal( current->item->value.first, key ) ) {
+        removed = current;
+        break;
+      }
+    }
+
+    if( removed == nullptr ) return false;
+
+    // Lookups standing on 'removed' still reach the rest of the chain
+    previous->store( removed->next.load(std::memory_order_relaxed),
+                     std::memory_order_release );
+    s.count.store( s.count.load(std::memory_order_relaxed) - 1,
+                   std::memory_order_relaxed );
+  }
+
+  p.retire( removed->item );
+  p.retire( removed );
+  help_resize( p );
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Capacity
+//----------------------------------------------------------------------------
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline typename bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>::size_type
+  bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>::size()
+  const noexcept
+{
+  auto result = size_type(0);
+
+  for( const auto& s : m_stripes ) {
+    result += s->count.load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline bool bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::empty()
+  const noexcept
+{
+  return size() == 0;
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline typename bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>::size_type
+  bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>::bucket_count()
+  const noexcept
+{
+  return m_table->load(std::memory_order_acquire)->mask + 1;
+}
+
+//----------------------------------------------------------------------------
+// Private Member Types
+//----------------------------------------------------------------------------
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+template<typename...Args>
+inline bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::entry::entry( const Key& key, Args&&...args )
+  : value( std::piecewise_construct,
+           std::forward_as_tuple(key),
+           std::forward_as_tuple(std::forward<Args>(args)...) )
+{
+
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::link::link( std::size_t hash, entry* item, link* next )
+  noexcept
+  : next(next),
+    hash(hash),
+    item(item)
+{
+
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::table::table( std::unique_ptr<bucket[]> buckets, size_type size )
+  noexcept
+  : buckets(std::move(buckets)),
+    mask(size - 1),
+    next(nullptr),
+    claimed(0),
+    migrated(0)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline std::size_t bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::mix( std::size_t hash )
+  noexcept
+{
+  // The finalizer of MurmurHash3; identity hashes of sequential keys would
+  // otherwise fill a stripe's buckets one after another
+  auto h = static_cast<std::uint64_t>(hash);
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+
+  return static_cast<std::size_t>(h);
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline typename bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>::size_type
+  bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::round_size( size_type bucket_count )
+  noexcept
+{
+  auto size = size_type(Stripes);
+
+  while( size < bucket_count ) {
+    size <<= 1;
+  }
+  return size;
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline void bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::destroy_chain( link* head )
+  noexcept
+{
+  while( head != nullptr ) {
+    auto* next = head->next.load(std::memory_order_relaxed);
+
+    delete head->item;
+    delete head;
+    head = next;
+  }
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline typename bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>::stripe&
+  bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::stripe_for( std::size_t hash )
+  noexcept
+{
+  return m_stripes[hash & (Stripes - 1)].get();
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline typename bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>::link*
+  bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::head_for( std::size_t hash )
+  const noexcept
+{
+  auto* t = m_table->load(std::memory_order_acquire);
+  auto* head = t->buckets[hash & t->mask].load(std::memory_order_acquire);
+
+  // The head is loaded once per table: a bucket that is migrated after the
+  // load still holds the chain that was loaded
+  while( head == &m_moved ) {
+    t = t->next.load(std::memory_order_acquire);
+    head = t->buckets[hash & t->mask].load(std::memory_order_acquire);
+  }
+  return head;
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline typename bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>::bucket&
+  bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::bucket_for( std::size_t hash )
+  noexcept
+{
+  auto* t = m_table->load(std::memory_order_acquire);
+
+  while( true ) {
+    auto& b = t->buckets[hash & t->mask];
+
+    if( b.load(std::memory_order_acquire) != &m_moved ) return b;
+
+    t = t->next.load(std::memory_order_acquire);
+  }
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline typename bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>::link*
+  bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::find_in( link* head, const Key& key, std::size_t hash )
+  const
+{
+  for( auto* l = head; l != nullptr; l = l->next.load(std::memory_order_acquire) ) {
+    if( l->hash == hash && m_equal( l->item->value.first, key ) ) {
+      return l;
+    }
+  }
+  return nullptr;
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline typename bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>::table*
+  bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::link_new( stripe& s, bucket& b, link* l )
+  noexcept
+{
+  l->next.store( b.load(std::memory_order_relaxed), std::memory_order_relaxed );
+
+  // Publishes the entry and the link to lookups
+  b.store( l, std::memory_order_release );
+
+  const auto count = s.count.load(std::memory_order_relaxed) + 1;
+  s.count.store( count, std::memory_order_relaxed );
+
+  auto* t = m_table->load(std::memory_order_acquire);
+
+  if( count > (t->mask + 1) / Stripes &&
+      t->next.load(std::memory_order_relaxed) == nullptr ) {
+    return t;
+  }
+  return nullptr;
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline bool bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::insert_entry( std::unique_ptr<entry> item )
+{
+  const auto& key = item->value.first;
+  const auto hash = mix( m_hash(key) );
+
+  auto l = std::unique_ptr<link>( new link( hash, item.get(), nullptr ) );
+
+  auto& p = epoch_domain::this_thread_participant();
+  epoch_domain::guard guard(p);
+
+  auto& s = stripe_for( hash );
+  auto* grow_from = static_cast<table*>(nullptr);
+  {
+    std::lock_guard<Mutex> lock(s.mutex);
+
+    auto& b = bucket_for( hash );
+
+    if( find_in( b.load(std::memory_order_relaxed), key, hash ) != nullptr ) {
+      return false;
+    }
+
+    grow_from = link_new( s, b, l.release() );
+    item.release();
+  }
+
+  if( grow_from != nullptr ) {
+    grow( grow_from );
+  }
+  help_resize( p );
+
+  return true;
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline void bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::grow( table* t )
+  noexcept
+{
+  if( t->next.load(std::memory_order_acquire) != nullptr ) return;
+
+  const auto size = t->mask + 1;
+
+  if( size > std::numeric_limits<size_type>::max() / sizeof(bucket) / 2 ) return;
+
+  // Failing to allocate leaves the map at its current size; a later insert
+  // will try again
+  auto buckets = std::unique_ptr<bucket[]>( new (std::nothrow) bucket[size * 2]() );
+  if( !buckets ) return;
+
+  auto* next = new (std::nothrow) table( std::move(buckets), size * 2 );
+  if( next == nullptr ) return;
+
+  // 't' is only retired once its resize completes, which requires its
+  // 'next' to be set, so a stale 't' fails here
+  auto* expected = static_cast<table*>(nullptr);
+  if( !t->next.compare_exchange_strong( expected, next,
+                                        std::memory_order_acq_rel,
+                                        std::memory_order_relaxed ) ) {
+    delete next;
+  }
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline void bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::help_resize( epoch_domain::participant& p )
+{
+  auto* t = m_table->load(std::memory_order_acquire);
+  auto* next = t->next.load(std::memory_order_acquire);
+
+  if( next == nullptr ) return;
+
+  const auto size  = t->mask + 1;
+  const auto first = t->claimed.fetch_add( migration_chunk, std::memory_order_relaxed );
+
+  if( first >= size ) return;
+
+  const auto last = std::min( first + migration_chunk, size );
+
+  for( auto i = first; i != last; ++i ) {
+    // A bucket that cannot be migrated stays in 't', where it is still
+    // found; the resize then never completes, and the map stops growing
+    if( !migrate( t, next, i, p ) ) return;
+  }
+
+  const auto count = last - first;
+
+  if( t->migrated.fetch_add( count, std::memory_order_acq_rel ) + count == size ) {
+    // Every bucket of 't' is a marker, so lookups that still load it are
+    // forwarded to 'next' until it is freed
+    m_table->store( next, std::memory_order_release );
+    p.retire( t );
+  }
+}
+
+template<typename Key, typename T, typename Hash, typename KeyEqual,
+         typename Mutex, std::size_t Stripes>
+inline bool bit::concurrency::concurrent_hash_map<Key,T,Hash,KeyEqual,Mutex,Stripes>
+  ::migrate( table* from,
+             table* to,
+             size_type index,
+             epoch_domain::participant& p )
+{
+  const auto size = from->mask + 1;
+
+  // Both tables have at least 'Stripes' buckets, so bucket 'index' of
+  // 'from' and the two buckets it splits into share its stripe
+  auto& s = m_stripes[index & (Stripes - 1)].get();
+  auto* head = static_cast<link*>(nullptr);
+  {
+    std::lock_guard<Mutex> lock(s.mutex);
+
+    auto& b = from->buckets[index];
+    head = b.load(std::memory_order_relaxed);
+
+    auto* low  = static_cast<link*>(nullptr);
+    auto* high = static_cast<link*>(nullptr);
+
+    // The old chain is left intact for lookups that are walking it, so
+    // each link is copied rather than moved
+    for( auto* l = head; l != nullptr; l = l->next.load(std::memory_order_relaxed) ) {
+      auto& list = (l->hash & size) ? high : low;
+      auto* copy = new (std::nothrow) link( l->hash, l->item, list );
+
+      if( copy == nullptr ) {
+        for( auto* partial : { low, high } ) {
+          while( partial != nullptr ) {
+            auto* next = partial->next.load(std::memory_order_relaxed);
+            delete partial;
+            partial = next;
+          }
+        }
+        return false;
+      }
+      list = copy;
+    }
+
+    to->buckets[index].store( low, std::memory_order_release );
+    to->buckets[index + size].store( high, std::memory_order_release );
+
+    // Published after the copies, so that a lookup forwarded by the marker
+    // finds them
+    b.store( &m_moved, std::memory_order_release );
+  }
+
+  // The old links no longer own their entries, which now belong to the
+  // copies
+  while( head != nullptr ) {
+    auto* next = head->next.load(std::memory_order_relaxed);
+    p.retire( head );
+    head = next;
+  }
+  return true;
+}
+
+#endif /* BIT_CONCURRENCY_CONTAINERS_DETAIL_CONCURRENT_HASH_MAP_INL */
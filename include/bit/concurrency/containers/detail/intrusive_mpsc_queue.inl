@@ -0,0 +1,209 @@
+#ifndef BIT_CONCURRENCY_CONTAINERS_DETAIL_INTRUSIVE_MPSC_QUEUE_INL
+#define BIT_CONCURRENCY_CONTAINERS_DETAIL_INTRUSIVE_MPSC_QUEUE_INL
+
+//============================================================================
+// mpsc_queue_hook
+//============================================================================
+
+inline bit::concurrency::mpsc_queue_hook::mpsc_queue_hook()
+  noexcept
+  : m_next(nullptr)
+{
+
+}
+
+inline bit::concurrency::mpsc_queue_hook
+  ::mpsc_queue_hook( const mpsc_queue_hook& )
+  noexcept
+  : m_next(nullptr)
+{
+
+}
+
+inline bit::concurrency::mpsc_queue_hook&
+  bit::concurrency::mpsc_queue_hook::operator=( const mpsc_queue_hook& )
+  noexcept
+{
+  return (*this);
+}
+
+//============================================================================
+// intrusive_mpsc_queue
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+template<typename T, bool Blocking>
+inline bit::concurrency::intrusive_mpsc_queue<T,Blocking>::intrusive_mpsc_queue()
+  : m_head(&m_stub),
+    m_tail(&m_stub),
+    m_stub(),
+    m_spin(),
+    m_sleeping(false),
+    m_event(waitable_event::reset_mode::automatic)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Producers
+//----------------------------------------------------------------------------
+
+template<typename T, bool Blocking>
+inline void bit::concurrency::intrusive_mpsc_queue<T,Blocking>::push( T* element )
+  noexcept
+{
+  link( static_cast<mpsc_queue_hook*>(element) );
+
+  if( Blocking ) {
+    // The link must be visible before the flag is read; this pairs with the
+    // fence in 'prepare_park', so that either the consumer sees the element,
+    // or this producer sees the consumer going to sleep.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if( m_sleeping.load(std::memory_order_relaxed) &&
+        m_sleeping.exchange(false, std::memory_order_acq_rel) ) {
+      m_event.signal();
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Consumer
+//----------------------------------------------------------------------------
+
+template<typename T, bool Blocking>
+inline T* bit::concurrency::intrusive_mpsc_queue<T,Blocking>::try_pop()
+  noexcept
+{
+  auto* tail = m_tail;
+  auto* next = tail->m_next.load(std::memory_order_acquire);
+
+  // Skip over the stub, which only keeps the list non-empty
+  if( tail == &m_stub ) {
+    if( next == nullptr ) return nullptr;
+
+    m_tail = next;
+    tail   = next;
+    next   = next->m_next.load(std::memory_order_acquire);
+  }
+
+  if( next != nullptr ) {
+    m_tail = next;
+    return static_cast<T*>(tail);
+  }
+
+  // A producer has exchanged the head, but not yet linked its node
+  if( tail != m_head->load(std::memory_order_acquire) ) return nullptr;
+
+  // 'tail' is the last node; re-insert the stub behind it so that it can be
+  // unlinked without racing a producer that links onto it
+  link( &m_stub );
+
+  next = tail->m_next.load(std::memory_order_acquire);
+
+  if( next != nullptr ) {
+    m_tail = next;
+    return static_cast<T*>(tail);
+  }
+  return nullptr;
+}
+
+template<typename T, bool Blocking>
+inline T* bit::concurrency::intrusive_mpsc_queue<T,Blocking>::pop()
+{
+  static_assert( Blocking, "pop requires a blocking intrusive_mpsc_queue" );
+
+  if( auto* element = spin_pop() ) return element;
+
+  while( true ) {
+    if( auto* element = prepare_park() ) return element;
+
+    m_event.wait();
+
+    if( auto* element = try_pop() ) return element;
+  }
+}
+
+template<typename T, bool Blocking>
+template<typename Rep, typename Period>
+inline T* bit::concurrency::intrusive_mpsc_queue<T,Blocking>
+  ::pop_for( const duration<Rep,Period>& duration )
+{
+  static_assert( Blocking, "pop_for requires a blocking intrusive_mpsc_queue" );
+
+  const auto deadline = std::chrono::steady_clock::now() + duration;
+
+  if( auto* element = spin_pop() ) return element;
+
+  while( true ) {
+    if( auto* element = prepare_park() ) return element;
+
+    const auto remaining = deadline - std::chrono::steady_clock::now();
+
+    if( remaining.count() <= 0 || !m_event.wait_for( remaining ) ) {
+      // A producer that claims the flag after this only leaves the event
+      // set, which the next park absorbs as a spurious wake-up
+      m_sleeping.store(false, std::memory_order_relaxed);
+      return try_pop();
+    }
+
+    if( auto* element = try_pop() ) return element;
+  }
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename T, bool Blocking>
+inline void bit::concurrency::intrusive_mpsc_queue<T,Blocking>
+  ::link( mpsc_queue_hook* node )
+  noexcept
+{
+  node->m_next.store(nullptr, std::memory_order_relaxed);
+
+  auto* previous = m_head->exchange(node, std::memory_order_acq_rel);
+  previous->m_next.store(node, std::memory_order_release);
+}
+
+template<typename T, bool Blocking>
+inline T* bit::concurrency::intrusive_mpsc_queue<T,Blocking>::spin_pop()
+  noexcept
+{
+  const auto budget = m_spin->spins();
+
+  for( auto spins = 0; spins < budget; ++spins ) {
+    if( auto* element = try_pop() ) {
+      m_spin->acquired(spins);
+      return element;
+    }
+    cpu_relax();
+  }
+  m_spin->parked();
+
+  return nullptr;
+}
+
+template<typename T, bool Blocking>
+inline T* bit::concurrency::intrusive_mpsc_queue<T,Blocking>::prepare_park()
+  noexcept
+{
+  m_sleeping.store(true, std::memory_order_relaxed);
+
+  // Pairs with the fence in 'push'
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  auto* element = try_pop();
+
+  if( element != nullptr ) {
+    // A producer may already have claimed the flag; its signal then only
+    // leaves the event set, which a later park absorbs
+    m_sleeping.store(false, std::memory_order_relaxed);
+  }
+  return element;
+}
+
+#endif /* BIT_CONCURRENCY_CONTAINERS_DETAIL_INTRUSIVE_MPSC_QUEUE_INL */
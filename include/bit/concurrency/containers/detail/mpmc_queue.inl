@@ -0,0 +1,324 @@
+#ifndef BIT_CONCURRENCY_CONTAINERS_DETAIL_MPMC_QUEUE_INL
+#define BIT_CONCURRENCY_CONTAINERS_DETAIL_MPMC_QUEUE_INL
+
+#include <cstdint> // std::intptr_t
+
+//----------------------------------------------------------------------------
+// Constructor / Destructor
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::concurrency::mpmc_queue<T>::mpmc_queue( size_type capacity )
+  : m_enqueue_position(0),
+    m_dequeue_position(0),
+    m_not_full(),
+    m_not_empty(),
+    m_cells(new cell[round_capacity(capacity)]),
+    m_mask(round_capacity(capacity) - 1)
+{
+  for( auto i = size_type(0); i <= m_mask; ++i ) {
+    m_cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+template<typename T>
+inline bit::concurrency::mpmc_queue<T>::~mpmc_queue()
+{
+  const auto last = m_enqueue_position->load(std::memory_order_relaxed);
+
+  for( auto i = m_dequeue_position->load(std::memory_order_relaxed);
+       i != last;
+       ++i ) {
+    reinterpret_cast<T*>(&m_cells[i & m_mask].storage)->~T();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Capacity
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline typename bit::concurrency::mpmc_queue<T>::size_type
+  bit::concurrency::mpmc_queue<T>::capacity()
+  const noexcept
+{
+  return m_mask + 1;
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bool bit::concurrency::mpmc_queue<T>::try_push( const T& value )
+{
+  return try_push( value, std::is_nothrow_copy_constructible<T>{} );
+}
+
+template<typename T>
+inline bool bit::concurrency::mpmc_queue<T>::try_push( T&& value )
+{
+  auto position = size_type();
+  auto* c = claim_push( position );
+
+  if( c == nullptr ) return false;
+
+  ::new (static_cast<void*>(&c->storage)) T( std::move(value) );
+  commit_push( *c, position );
+  return true;
+}
+
+template<typename T>
+inline void bit::concurrency::mpmc_queue<T>::push( const T& value )
+{
+  auto copy = T(value);
+
+  push( std::move(copy) );
+}
+
+template<typename T>
+inline void bit::concurrency::mpmc_queue<T>::push( T&& value )
+{
+  auto backoff = spin_then_yield_backoff<>();
+
+  while( !try_push( std::move(value) ) ) {
+    // A consumer of the previous lap still holds the cell; it is about to
+    // be free, so only a full queue is worth parking on
+    if( !full() ) {
+      backoff();
+      continue;
+    }
+
+    const auto key = m_not_full->prepare_wait();
+
+    if( !full() ) {
+      m_not_full->cancel_wait();
+      continue;
+    }
+    m_not_full->commit_wait( key );
+  }
+}
+
+template<typename T>
+inline bool bit::concurrency::mpmc_queue<T>::try_pop( T& out )
+{
+  auto position = size_type();
+  auto* c = claim_pop( position );
+
+  if( c == nullptr ) return false;
+
+  commit_pop( *c, position, out );
+  return true;
+}
+
+template<typename T>
+inline void bit::concurrency::mpmc_queue<T>::pop( T& out )
+{
+  auto backoff = spin_then_yield_backoff<>();
+
+  while( !try_pop( out ) ) {
+    // A producer has claimed the cell and is still filling it
+    if( !empty() ) {
+      backoff();
+      continue;
+    }
+
+    const auto key = m_not_empty->prepare_wait();
+
+    if( !empty() ) {
+      m_not_empty->cancel_wait();
+      continue;
+    }
+    m_not_empty->commit_wait( key );
+  }
+}
+
+template<typename T>
+template<typename Rep, typename Period>
+inline bool bit::concurrency::mpmc_queue<T>
+  ::pop_for( T& out, const duration<Rep,Period>& duration )
+{
+  return pop_until( out, std::chrono::steady_clock::now() + duration );
+}
+
+template<typename T>
+template<typename Clock, typename Duration>
+inline bool bit::concurrency::mpmc_queue<T>
+  ::pop_until( T& out, const time_point<Clock,Duration>& time )
+{
+  auto backoff = spin_then_yield_backoff<>();
+
+  while( !try_pop( out ) ) {
+    if( Clock::now() >= time ) return false;
+
+    if( !empty() ) {
+      backoff();
+      continue;
+    }
+
+    const auto key = m_not_empty->prepare_wait();
+
+    if( !empty() ) {
+      m_not_empty->cancel_wait();
+      continue;
+    }
+    if( !m_not_empty->commit_wait_until( key, time ) ) {
+      return try_pop( out );
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline typename bit::concurrency::mpmc_queue<T>::cell*
+  bit::concurrency::mpmc_queue<T>::claim_push( size_type& position )
+  noexcept
+{
+  position = m_enqueue_position->load(std::memory_order_relaxed);
+
+  while( true ) {
+    auto& c = m_cells[position & m_mask];
+    const auto sequence = c.sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<std::intptr_t>(sequence)
+                    - static_cast<std::intptr_t>(position);
+
+    if( diff == 0 ) {
+      // Failure reloads 'position'
+      if( m_enqueue_position->compare_exchange_weak( position, position + 1,
+                                                     std::memory_order_relaxed,
+                                                     std::memory_order_relaxed ) ) {
+        return &c;
+      }
+    } else if( diff < 0 ) {
+      // The cell still holds, or is still being emptied of, the previous
+      // lap's element
+      return nullptr;
+    } else {
+      // Another producer claimed this position first
+      position = m_enqueue_position->load(std::memory_order_relaxed);
+    }
+  }
+}
+
+template<typename T>
+inline typename bit::concurrency::mpmc_queue<T>::cell*
+  bit::concurrency::mpmc_queue<T>::claim_pop( size_type& position )
+  noexcept
+{
+  position = m_dequeue_position->load(std::memory_order_relaxed);
+
+  while( true ) {
+    auto& c = m_cells[position & m_mask];
+    const auto sequence = c.sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<std::intptr_t>(sequence)
+                    - static_cast<std::intptr_t>(position + 1);
+
+    if( diff == 0 ) {
+      if( m_dequeue_position->compare_exchange_weak( position, position + 1,
+                                                     std::memory_order_relaxed,
+                                                     std::memory_order_relaxed ) ) {
+        return &c;
+      }
+    } else if( diff < 0 ) {
+      // The cell is empty, or its producer is still filling it
+      return nullptr;
+    } else {
+      position = m_dequeue_position->load(std::memory_order_relaxed);
+    }
+  }
+}
+
+template<typename T>
+inline void bit::concurrency::mpmc_queue<T>
+  ::commit_push( cell& c, size_type position )
+  noexcept
+{
+  c.sequence.store(position + 1, std::memory_order_release);
+
+  m_not_empty->notify_one();
+}
+
+template<typename T>
+inline void bit::concurrency::mpmc_queue<T>
+  ::commit_pop( cell& c, size_type position, T& out )
+  noexcept
+{
+  auto* p = reinterpret_cast<T*>(&c.storage);
+  out = std::move(*p);
+  p->~T();
+
+  // Hand the cell to the producer of the next lap
+  c.sequence.store(position + m_mask + 1, std::memory_order_release);
+
+  m_not_full->notify_one();
+}
+
+template<typename T>
+inline bool bit::concurrency::mpmc_queue<T>
+  ::try_push( const T& value, std::true_type )
+{
+  auto position = size_type();
+  auto* c = claim_push( position );
+
+  if( c == nullptr ) return false;
+
+  ::new (static_cast<void*>(&c->storage)) T( value );
+  commit_push( *c, position );
+  return true;
+}
+
+template<typename T>
+inline bool bit::concurrency::mpmc_queue<T>
+  ::try_push( const T& value, std::false_type )
+{
+  // A claimed cell cannot be given back, so a copy that may throw is made
+  // before claiming; checking first avoids copying into a full queue
+  if( full() ) return false;
+
+  auto copy = T(value);
+
+  return try_push( std::move(copy) );
+}
+
+template<typename T>
+inline bool bit::concurrency::mpmc_queue<T>::full()
+  const noexcept
+{
+  // Loading the enqueue position first can only understate the size, and
+  // consumers may even have passed it by the time the dequeue position is
+  // loaded
+  const auto enqueue = m_enqueue_position->load(std::memory_order_seq_cst);
+  const auto dequeue = m_dequeue_position->load(std::memory_order_seq_cst);
+  const auto size    = static_cast<std::intptr_t>(enqueue - dequeue);
+
+  return size > static_cast<std::intptr_t>(m_mask);
+}
+
+template<typename T>
+inline bool bit::concurrency::mpmc_queue<T>::empty()
+  const noexcept
+{
+  // Loading the dequeue position first can only overstate the size
+  const auto dequeue = m_dequeue_position->load(std::memory_order_seq_cst);
+  const auto enqueue = m_enqueue_position->load(std::memory_order_seq_cst);
+
+  return enqueue == dequeue;
+}
+
+template<typename T>
+inline typename bit::concurrency::mpmc_queue<T>::size_type
+  bit::concurrency::mpmc_queue<T>::round_capacity( size_type capacity )
+  noexcept
+{
+  auto result = size_type(2);
+  while( result < capacity ) {
+    result <<= 1;
+  }
+  return result;
+}
+
+#endif /* BIT_CONCURRENCY_CONTAINERS_DETAIL_MPMC_QUEUE_INL */
@@ -0,0 +1,398 @@
+#ifndef BIT_CONCURRENCY_CONTAINERS_DETAIL_SPSC_RING_INL
+#define BIT_CONCURRENCY_CONTAINERS_DETAIL_SPSC_RING_INL
+
+//============================================================================
+// detail::spsc_ring_parking
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Protected Member Functions
+//----------------------------------------------------------------------------
+
+template<bool Blocking>
+inline void bit::concurrency::detail::spsc_ring_parking<Blocking>::notify_readable()
+{
+  notify( *m_readable );
+}
+
+template<bool Blocking>
+inline void bit::concurrency::detail::spsc_ring_parking<Blocking>::notify_writable()
+{
+  notify( *m_writable );
+}
+
+template<bool Blocking>
+inline void bit::concurrency::detail::spsc_ring_parking<Blocking>
+  ::notify( parking_line& line )
+{
+  // The published index must be visible before the flag is read; this pairs
+  // with the fence in 'park', so that either the waiter sees the index, or
+  // this side sees the waiter.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if( line.waiting.load(std::memory_order_relaxed) &&
+      line.waiting.exchange(false, std::memory_order_acq_rel) ) {
+    line.semaphore.signal();
+  }
+}
+
+//----------------------------------------------------------------------------
+
+inline void bit::concurrency::detail::spsc_ring_parking<false>::notify_readable()
+  noexcept
+{
+
+}
+
+inline void bit::concurrency::detail::spsc_ring_parking<false>::notify_writable()
+  noexcept
+{
+
+}
+
+//============================================================================
+// spsc_ring::span
+//============================================================================
+
+template<typename T, bool Blocking>
+inline constexpr bit::concurrency::spsc_ring<T,Blocking>::span::span()
+  noexcept
+  : m_data(nullptr),
+    m_size(0)
+{
+
+}
+
+template<typename T, bool Blocking>
+inline constexpr bit::concurrency::spsc_ring<T,Blocking>::span
+  ::span( T* data, size_type size )
+  noexcept
+  : m_data(data),
+    m_size(size)
+{
+
+}
+
+template<typename T, bool Blocking>
+inline constexpr T* bit::concurrency::spsc_ring<T,Blocking>::span::data()
+  const noexcept
+{
+  return m_data;
+}
+
+template<typename T, bool Blocking>
+inline constexpr typename bit::concurrency::spsc_ring<T,Blocking>::size_type
+  bit::concurrency::spsc_ring<T,Blocking>::span::size()
+  const noexcept
+{
+  return m_size;
+}
+
+template<typename T, bool Blocking>
+inline constexpr bool bit::concurrency::spsc_ring<T,Blocking>::span::empty()
+  const noexcept
+{
+  return m_size == 0;
+}
+
+template<typename T, bool Blocking>
+inline constexpr T* bit::concurrency::spsc_ring<T,Blocking>::span::begin()
+  const noexcept
+{
+  return m_data;
+}
+
+template<typename T, bool Blocking>
+inline constexpr T* bit::concurrency::spsc_ring<T,Blocking>::span::end()
+  const noexcept
+{
+  return m_data + m_size;
+}
+
+template<typename T, bool Blocking>
+inline T& bit::concurrency::spsc_ring<T,Blocking>::span
+  ::operator[]( size_type index )
+  const noexcept
+{
+  assert( index < m_size );
+
+  return m_data[index];
+}
+
+//============================================================================
+// spsc_ring
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor / Destructor
+//----------------------------------------------------------------------------
+
+template<typename T, bool Blocking>
+inline bit::concurrency::spsc_ring<T,Blocking>::spsc_ring( size_type capacity )
+  : m_producer(),
+    m_consumer(),
+    m_buffer(new storage_type[round_capacity(capacity)]),
+    m_mask(round_capacity(capacity) - 1)
+{
+
+}
+
+template<typename T, bool Blocking>
+inline bit::concurrency::spsc_ring<T,Blocking>::~spsc_ring()
+{
+  const auto last = m_producer->tail.load(std::memory_order_relaxed);
+
+  for( auto i = m_consumer->head.load(std::memory_order_relaxed); i != last; ++i ) {
+    cell(i)->~T();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Capacity
+//----------------------------------------------------------------------------
+
+template<typename T, bool Blocking>
+inline typename bit::concurrency::spsc_ring<T,Blocking>::size_type
+  bit::concurrency::spsc_ring<T,Blocking>::capacity()
+  const noexcept
+{
+  return m_mask + 1;
+}
+
+//----------------------------------------------------------------------------
+// Producer
+//----------------------------------------------------------------------------
+
+template<typename T, bool Blocking>
+inline typename bit::concurrency::spsc_ring<T,Blocking>::span
+  bit::concurrency::spsc_ring<T,Blocking>::try_reserve( size_type count )
+  noexcept
+{
+  const auto tail = m_producer->tail.load(std::memory_order_relaxed);
+  auto free = capacity() - (tail - m_producer->head_cache);
+
+  // Only touch the consumer's line once the cached view is insufficient
+  if( free < count ) {
+    m_producer->head_cache = m_consumer->head.load(std::memory_order_acquire);
+    free = capacity() - (tail - m_producer->head_cache);
+  }
+
+  const auto contiguous = capacity() - (tail & m_mask);
+
+  auto size = count;
+  if( size > free )       size = free;
+  if( size > contiguous ) size = contiguous;
+
+  m_producer->reserved = size;
+  return span( cell(tail), size );
+}
+
+template<typename T, bool Blocking>
+inline typename bit::concurrency::spsc_ring<T,Blocking>::span
+  bit::concurrency::spsc_ring<T,Blocking>::reserve( size_type count )
+{
+  static_assert( Blocking, "reserve requires a blocking spsc_ring" );
+  assert( count > 0 );
+
+  return park( *this->m_writable, [this,count]() {
+    return try_reserve( count );
+  } );
+}
+
+template<typename T, bool Blocking>
+inline void bit::concurrency::spsc_ring<T,Blocking>::commit( size_type count )
+{
+  assert( count <= m_producer->reserved );
+
+  m_producer->reserved -= count;
+
+  const auto tail = m_producer->tail.load(std::memory_order_relaxed);
+  m_producer->tail.store(tail + count, std::memory_order_release);
+
+  this->notify_readable();
+}
+
+template<typename T, bool Blocking>
+inline bool bit::concurrency::spsc_ring<T,Blocking>::try_push( const T& value )
+{
+  auto cells = try_reserve(1);
+
+  if( cells.empty() ) return false;
+
+  ::new (static_cast<void*>(cells.data())) T( value );
+  commit(1);
+  return true;
+}
+
+template<typename T, bool Blocking>
+inline bool bit::concurrency::spsc_ring<T,Blocking>::try_push( T&& value )
+{
+  auto cells = try_reserve(1);
+
+  if( cells.empty() ) return false;
+
+  ::new (static_cast<void*>(cells.data())) T( std::move(value) );
+  commit(1);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Consumer
+//----------------------------------------------------------------------------
+
+template<typename T, bool Blocking>
+inline typename bit::concurrency::spsc_ring<T,Blocking>::span
+  bit::concurrency::spsc_ring<T,Blocking>::peek()
+  noexcept
+{
+  const auto head = m_consumer->head.load(std::memory_order_relaxed);
+  auto available = m_consumer->tail_cache - head;
+
+  // Only touch the producer's line once the cached view is exhausted
+  if( available == 0 ) {
+    m_consumer->tail_cache = m_producer->tail.load(std::memory_order_acquire);
+    available = m_consumer->tail_cache - head;
+  }
+
+  const auto contiguous = capacity() - (head & m_mask);
+
+  m_consumer->peeked = available < contiguous ? available : contiguous;
+  return span( cell(head), m_consumer->peeked );
+}
+
+template<typename T, bool Blocking>
+inline typename bit::concurrency::spsc_ring<T,Blocking>::span
+  bit::concurrency::spsc_ring<T,Blocking>::wait_peek()
+{
+  static_assert( Blocking, "wait_peek requires a blocking spsc_ring" );
+
+  return park( *this->m_readable, [this]() {
+    return peek();
+  } );
+}
+
+template<typename T, bool Blocking>
+template<typename Rep, typename Period>
+inline typename bit::concurrency::spsc_ring<T,Blocking>::span
+  bit::concurrency::spsc_ring<T,Blocking>
+  ::wait_peek_for( const duration<Rep,Period>& duration )
+{
+  static_assert( Blocking, "wait_peek_for requires a blocking spsc_ring" );
+
+  const auto deadline = std::chrono::steady_clock::now() + duration;
+
+  auto result = peek();
+
+  auto& line = *this->m_readable;
+
+  while( result.empty() ) {
+    line.waiting.store(true, std::memory_order_relaxed);
+
+    // Pairs with the fence in 'notify'
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    result = peek();
+    if( !result.empty() ) {
+      // The producer may have claimed the flag already; absorb its signal
+      if( !line.waiting.exchange(false, std::memory_order_acquire) ) {
+        line.semaphore.wait();
+      }
+      break;
+    }
+
+    const auto remaining = deadline - std::chrono::steady_clock::now();
+
+    if( remaining.count() <= 0 || !line.semaphore.try_wait_for( remaining ) ) {
+      // Timed out without a signal in flight
+      if( line.waiting.exchange(false, std::memory_order_acquire) ) {
+        return peek();
+      }
+      line.semaphore.wait();
+    }
+    result = peek();
+  }
+  return result;
+}
+
+template<typename T, bool Blocking>
+inline void bit::concurrency::spsc_ring<T,Blocking>::consume( size_type count )
+{
+  assert( count <= m_consumer->peeked );
+
+  m_consumer->peeked -= count;
+
+  const auto head = m_consumer->head.load(std::memory_order_relaxed);
+
+  for( auto i = size_type(0); i < count; ++i ) {
+    cell(head + i)->~T();
+  }
+  m_consumer->head.store(head + count, std::memory_order_release);
+
+  this->notify_writable();
+}
+
+template<typename T, bool Blocking>
+inline bool bit::concurrency::spsc_ring<T,Blocking>::try_pop( T& out )
+{
+  auto elements = peek();
+
+  if( elements.empty() ) return false;
+
+  out = std::move( elements[0] );
+  consume(1);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename T, bool Blocking>
+inline T* bit::concurrency::spsc_ring<T,Blocking>::cell( size_type index )
+  const noexcept
+{
+  return reinterpret_cast<T*>(&m_buffer[index & m_mask]);
+}
+
+template<typename T, bool Blocking>
+template<typename Line, typename Poll>
+inline typename bit::concurrency::spsc_ring<T,Blocking>::span
+  bit::concurrency::spsc_ring<T,Blocking>
+  ::park( Line& line, Poll poll )
+{
+  auto result = poll();
+
+  while( result.empty() ) {
+    line.waiting.store(true, std::memory_order_relaxed);
+
+    // Pairs with the fence in 'notify'
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    result = poll();
+    if( !result.empty() ) {
+      // The other side may have claimed the flag already; absorb its signal
+      if( !line.waiting.exchange(false, std::memory_order_acquire) ) {
+        line.semaphore.wait();
+      }
+      break;
+    }
+
+    line.semaphore.wait();
+    result = poll();
+  }
+  return result;
+}
+
+template<typename T, bool Blocking>
+inline typename bit::concurrency::spsc_ring<T,Blocking>::size_type
+  bit::concurrency::spsc_ring<T,Blocking>::round_capacity( size_type capacity )
+  noexcept
+{
+  auto result = size_type(1);
+  while( result < capacity ) {
+    result <<= 1;
+  }
+  return result;
+}
+
+#endif /* BIT_CONCURRENCY_CONTAINERS_DETAIL_SPSC_RING_INL */
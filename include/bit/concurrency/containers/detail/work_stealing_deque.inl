@@ -0,0 +1,177 @@
+#ifndef BIT_CONCURRENCY_CONTAINERS_DETAIL_WORK_STEALING_DEQUE_INL
+#define BIT_CONCURRENCY_CONTAINERS_DETAIL_WORK_STEALING_DEQUE_INL
+
+//============================================================================
+// work_stealing_deque::buffer
+//============================================================================
+
+template<typename T>
+inline bit::concurrency::work_stealing_deque<T>::buffer
+  ::buffer( std::int64_t capacity )
+  : mask(capacity - 1),
+    cells(new std::atomic<T>[static_cast<std::size_t>(capacity)])
+{
+
+}
+
+template<typename T>
+inline T bit::concurrency::work_stealing_deque<T>::buffer
+  ::load( std::int64_t index )
+  const noexcept
+{
+  return cells[index & mask].load(std::memory_order_relaxed);
+}
+
+template<typename T>
+inline void bit::concurrency::work_stealing_deque<T>::buffer
+  ::store( std::int64_t index, T value )
+  noexcept
+{
+  cells[index & mask].store(value, std::memory_order_relaxed);
+}
+
+//============================================================================
+// work_stealing_deque
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bit::concurrency::work_stealing_deque<T>
+  ::work_stealing_deque( size_type capacity )
+  : m_top(0),
+    m_bottom(0),
+    m_buffer(nullptr),
+    m_buffers()
+{
+  auto rounded = std::int64_t(1);
+  while( static_cast<size_type>(rounded) < capacity ) {
+    rounded <<= 1;
+  }
+
+  m_buffers.push_back( std::unique_ptr<buffer>( new buffer(rounded) ) );
+  m_buffer->store(m_buffers.back().get(), std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+// Owner
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::concurrency::work_stealing_deque<T>::push( T value )
+{
+  const auto bottom = m_bottom.load(std::memory_order_relaxed);
+  const auto top    = m_top->load(std::memory_order_acquire);
+  auto* b = m_buffer->load(std::memory_order_relaxed);
+
+  if( bottom - top > b->mask ) {
+    b = grow( b, top, bottom );
+  }
+
+  b->store( bottom, value );
+
+  // Publishes the element with the new bottom
+  m_bottom.store(bottom + 1, std::memory_order_release);
+}
+
+template<typename T>
+inline bool bit::concurrency::work_stealing_deque<T>::pop( T& out )
+  noexcept
+{
+  const auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+  auto* b = m_buffer->load(std::memory_order_relaxed);
+
+  m_bottom.store(bottom, std::memory_order_relaxed);
+
+  // The claim on 'bottom' must be visible before 'top' is read; this pairs
+  // with the fence in 'steal', so that the owner and a thief cannot both
+  // take the last element.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  auto top = m_top->load(std::memory_order_relaxed);
+
+  if( top > bottom ) {
+    // Empty; restore the bottom
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    return false;
+  }
+
+  out = b->load( bottom );
+
+  if( top == bottom ) {
+    // The last element; race the thieves for it
+    const auto won = m_top->compare_exchange_strong( top, top + 1,
+                                                     std::memory_order_seq_cst,
+                                                     std::memory_order_relaxed );
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    return won;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Thieves
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline bool bit::concurrency::work_stealing_deque<T>::steal( T& out )
+  noexcept
+{
+  auto top = m_top->load(std::memory_order_acquire);
+
+  // Pairs with the fence in 'pop'
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  const auto bottom = m_bottom.load(std::memory_order_acquire);
+
+  if( top >= bottom ) return false;
+
+  // The element must be read before the claim; the owner may overwrite the
+  // cell as soon as the top moves past it
+  const auto* b = m_buffer->load(std::memory_order_acquire);
+  const auto value = b->load( top );
+
+  if( !m_top->compare_exchange_strong( top, top + 1,
+                                       std::memory_order_seq_cst,
+                                       std::memory_order_relaxed ) ) {
+    return false;
+  }
+
+  out = value;
+  return true;
+}
+
+template<typename T>
+inline bool bit::concurrency::work_stealing_deque<T>::empty()
+  const noexcept
+{
+  const auto top    = m_top->load(std::memory_order_acquire);
+  const auto bottom = m_bottom.load(std::memory_order_acquire);
+
+  return top >= bottom;
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline typename bit::concurrency::work_stealing_deque<T>::buffer*
+  bit::concurrency::work_stealing_deque<T>
+  ::grow( buffer* old, std::int64_t top, std::int64_t bottom )
+{
+  m_buffers.push_back( std::unique_ptr<buffer>( new buffer( (old->mask + 1) * 2 ) ) );
+  auto* b = m_buffers.back().get();
+
+  for( auto i = top; i < bottom; ++i ) {
+    b->store( i, old->load(i) );
+  }
+
+  // Thieves that still read 'old' see the same elements at the same indices
+  m_buffer->store(b, std::memory_order_release);
+  return b;
+}
+
+#endif /* BIT_CONCURRENCY_CONTAINERS_DETAIL_WORK_STEALING_DEQUE_INL */
@@ -0,0 +1,189 @@
+/**
+ * \file intrusive_mpsc_queue.hpp
+ *
+ * \brief This header contains an unbounded, intrusive multi-producer,
+ *        single-consumer queue
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_CONTAINERS_INTRUSIVE_MPSC_QUEUE_HPP
+#define BIT_CONCURRENCY_CONTAINERS_INTRUSIVE_MPSC_QUEUE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../locks/waitable_event.hpp"
+
+#include "../utilities/backoff.hpp"
+#include "../utilities/cache_aligned.hpp"
+#include "../utilities/spin_budget.hpp"
+
+#include <atomic>      // std::atomic
+#include <chrono>      // std::chrono::duration
+#include <type_traits> // std::is_base_of
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief The link that an element must inherit from to be pushed into
+    ///        an intrusive_mpsc_queue
+    ///
+    /// An element may be in at most one queue at a time.
+    //////////////////////////////////////////////////////////////////////////
+    class mpsc_queue_hook
+    {
+    public:
+
+      /// \brief Constructs an unlinked hook
+      mpsc_queue_hook() noexcept;
+
+      // The link belongs to the queue, so copying an element never copies it
+      mpsc_queue_hook( const mpsc_queue_hook& ) noexcept;
+      mpsc_queue_hook& operator=( const mpsc_queue_hook& ) noexcept;
+
+    private:
+
+      std::atomic<mpsc_queue_hook*> m_next;
+
+      template<typename,bool> friend class intrusive_mpsc_queue;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief An unbounded, allocation-free queue for any number of producers
+    ///        and a single consumer
+    ///
+    /// This is Dmitry Vyukov's intrusive MPSC node queue. A push is a single
+    /// atomic exchange followed by a store, so producers never wait on one
+    /// another or on the consumer. The queue never allocates: elements are
+    /// linked through their mpsc_queue_hook base, and remain owned by the
+    /// caller.
+    ///
+    /// A push that has exchanged the head but not yet linked its node makes
+    /// the queue briefly look empty to the consumer; \c try_pop then returns
+    /// \c nullptr even though an element is in flight.
+    ///
+    /// When \p Blocking is \c true, \c pop and \c pop_for poll the queue for
+    /// an adaptive spin_budget, and only then park on a waitable_event. This
+    /// costs each push a fence and a load; the non-blocking queue pays
+    /// nothing for it.
+    ///
+    /// \tparam T the element type. Must derive from mpsc_queue_hook
+    /// \tparam Blocking whether the blocking operations are available
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T, bool Blocking = false>
+    class intrusive_mpsc_queue
+    {
+      static_assert( std::is_base_of<mpsc_queue_hook,T>::value,
+                     "intrusive_mpsc_queue elements must derive from mpsc_queue_hook" );
+
+      template<typename Rep, typename Period>
+      using duration = std::chrono::duration<Rep,Period>;
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+
+      //----------------------------------------------------------------------
+      // Constructors / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty intrusive_mpsc_queue
+      intrusive_mpsc_queue();
+
+      // Deleted copy constructor
+      intrusive_mpsc_queue( const intrusive_mpsc_queue& ) = delete;
+
+      // Deleted move constructor
+      intrusive_mpsc_queue( intrusive_mpsc_queue&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      intrusive_mpsc_queue& operator=( const intrusive_mpsc_queue& ) = delete;
+
+      // Deleted move assignment
+      intrusive_mpsc_queue& operator=( intrusive_mpsc_queue&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Producers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Pushes \p element to the back of the queue
+      ///
+      /// \param element the element to push. Must not be in any queue, and
+      ///                must outlive its stay in this one
+      void push( T* element ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Consumer
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Pops the front element, unless the queue appears empty
+      ///
+      /// \return the front element, or \c nullptr
+      T* try_pop() noexcept;
+
+      /// \brief Pops the front element, waiting while the queue is empty
+      ///
+      /// Only available when \p Blocking is \c true.
+      ///
+      /// \return the front element
+      T* pop();
+
+      /// \brief Pops the front element, waiting at most \p duration while
+      ///        the queue is empty
+      ///
+      /// Only available when \p Blocking is \c true.
+      ///
+      /// \param duration the maximum time to wait
+      /// \return the front element, or \c nullptr on timeout
+      template<typename Rep, typename Period>
+      T* pop_for( const duration<Rep,Period>& duration );
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      padded<std::atomic<mpsc_queue_hook*>> m_head; ///< last pushed
+
+      // Consumer-owned line
+      mpsc_queue_hook*    m_tail; ///< next to pop
+      mpsc_queue_hook     m_stub;
+      padded<spin_budget> m_spin;
+
+      // Only used when Blocking
+      std::atomic<bool> m_sleeping;
+      waitable_event    m_event;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Links \p node at the back of the queue
+      void link( mpsc_queue_hook* node ) noexcept;
+
+      /// \brief Polls the queue for up to the spin budget
+      T* spin_pop() noexcept;
+
+      /// \brief Announces that the consumer is about to park
+      ///
+      /// \return the front element, if one arrived in the meantime
+      T* prepare_park() noexcept;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/intrusive_mpsc_queue.inl"
+
+#endif /* BIT_CONCURRENCY_CONTAINERS_INTRUSIVE_MPSC_QUEUE_HPP */
@@ -0,0 +1,233 @@
+/**
+ * \file mpmc_queue.hpp
+ *
+ * \brief This header contains a bounded multi-producer, multi-consumer queue
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_CONTAINERS_MPMC_QUEUE_HPP
+#define BIT_CONCURRENCY_CONTAINERS_MPMC_QUEUE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../locks/eventcount.hpp"
+
+#include "../utilities/backoff.hpp"
+#include "../utilities/cache_aligned.hpp"
+
+#include <atomic>      // std::atomic
+#include <chrono>      // std::chrono::duration, std::chrono::time_point
+#include <cstddef>     // std::size_t
+#include <memory>      // std::unique_ptr
+#include <new>         // placement new
+#include <type_traits> // std::aligned_storage, std::is_nothrow_*, ...
+#include <utility>     // std::move
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A fixed-capacity, lock-free queue for any number of producers
+    ///        and consumers
+    ///
+    /// The core is Dmitry Vyukov's bounded MPMC ring: every cell carries a
+    /// sequence number that tells producers and consumers whether it is
+    /// ready for them, and a position is claimed with a compare-and-swap
+    /// only once its cell is ready. \c try_push and \c try_pop never wait:
+    /// they fail if the cell at their position is still held, including by
+    /// a producer or consumer of an earlier lap that has not yet finished.
+    /// The enqueue and dequeue positions live on separate cache lines, so
+    /// producers and consumers do not contend with each other.
+    ///
+    /// Blocking operations park on one of two eventcounts, and only once
+    /// the queue is full or empty by its positions. Every push and pop
+    /// notifies the other side, which costs a fence and a load while nobody
+    /// is parked.
+    ///
+    /// \tparam T the element type. Moving and destroying it must not throw
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class mpmc_queue
+    {
+      static_assert( std::is_nothrow_move_constructible<T>::value &&
+                     std::is_nothrow_move_assignable<T>::value &&
+                     std::is_nothrow_destructible<T>::value,
+                     "mpmc_queue requires nothrow move and destruction" );
+
+      template<typename Rep, typename Period>
+      using duration = std::chrono::duration<Rep,Period>;
+
+      template<typename Clock, typename Duration>
+      using time_point = std::chrono::time_point<Clock,Duration>;
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+      using size_type  = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty mpmc_queue
+      ///
+      /// \param capacity the minimum capacity. Rounded up to a power of two
+      ///                 no smaller than 2
+      explicit mpmc_queue( size_type capacity );
+
+      // Deleted copy constructor
+      mpmc_queue( const mpmc_queue& ) = delete;
+
+      // Deleted move constructor
+      mpmc_queue( mpmc_queue&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Destroys the queue and every element still in it
+      ~mpmc_queue();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      mpmc_queue& operator=( const mpmc_queue& ) = delete;
+
+      // Deleted move assignment
+      mpmc_queue& operator=( mpmc_queue&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Capacity
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns the number of elements the queue can hold
+      ///
+      /// \return the capacity
+      size_type capacity() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Pushes \p value, unless the queue is full
+      ///
+      /// \p value is only copied once a cell has been found for it.
+      ///
+      /// \param value the value to push
+      /// \return \c true if the value was pushed
+      bool try_push( const T& value );
+      bool try_push( T&& value );
+
+      /// \brief Pushes \p value, waiting while the queue is full
+      ///
+      /// \param value the value to push
+      void push( const T& value );
+      void push( T&& value );
+
+      /// \brief Pops the oldest element into \p out, unless the queue is
+      ///        empty
+      ///
+      /// \param out the object to move the element into
+      /// \return \c true if an element was popped
+      bool try_pop( T& out );
+
+      /// \brief Pops the oldest element into \p out, waiting while the
+      ///        queue is empty
+      ///
+      /// \param out the object to move the element into
+      void pop( T& out );
+
+      /// \brief Pops the oldest element into \p out, waiting at most
+      ///        \p duration while the queue is empty
+      ///
+      /// \param out the object to move the element into
+      /// \param duration the maximum time to wait
+      /// \return \c true if an element was popped
+      template<typename Rep, typename Period>
+      bool pop_for( T& out, const duration<Rep,Period>& duration );
+
+      /// \brief Pops the oldest element into \p out, waiting until \p time
+      ///        at the latest while the queue is empty
+      ///
+      /// \param out the object to move the element into
+      /// \param time the time point to stop waiting
+      /// \return \c true if an element was popped
+      template<typename Clock, typename Duration>
+      bool pop_until( T& out, const time_point<Clock,Duration>& time );
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      using storage_type = typename std::aligned_storage<sizeof(T),alignof(T)>::type;
+
+      struct cell
+      {
+        std::atomic<size_type> sequence;
+        storage_type           storage;
+      };
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      padded<std::atomic<size_type>> m_enqueue_position;
+      padded<std::atomic<size_type>> m_dequeue_position;
+
+      padded<eventcount> m_not_full;
+      padded<eventcount> m_not_empty;
+
+      std::unique_ptr<cell[]> m_cells;
+      size_type               m_mask;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Claims the cell at the enqueue position, if it is free
+      ///
+      /// \param position set to the claimed position
+      /// \return the cell, or null if the queue is full
+      cell* claim_push( size_type& position ) noexcept;
+
+      /// \brief Claims the cell at the dequeue position, if it is ready
+      ///
+      /// \param position set to the claimed position
+      /// \return the cell, or null if the queue is empty
+      cell* claim_pop( size_type& position ) noexcept;
+
+      /// \brief Publishes the value constructed in \p c to consumers
+      void commit_push( cell& c, size_type position ) noexcept;
+
+      /// \brief Moves the value out of \p c into \p out, and hands \p c to
+      ///        the producers of the next lap
+      void commit_pop( cell& c, size_type position, T& out ) noexcept;
+
+      bool try_push( const T& value, std::true_type );
+      bool try_push( const T& value, std::false_type );
+
+      /// \brief Checks whether every cell is claimed by a producer
+      bool full() const noexcept;
+
+      /// \brief Checks whether no cell is claimed by a producer ahead of the
+      ///        consumers
+      bool empty() const noexcept;
+
+      static size_type round_capacity( size_type capacity ) noexcept;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/mpmc_queue.inl"
+
+#endif /* BIT_CONCURRENCY_CONTAINERS_MPMC_QUEUE_HPP */
@@ -0,0 +1,331 @@
+/**
+ * \file spsc_ring.hpp
+ *
+ * \brief This header contains a single-producer, single-consumer ring buffer
+ *        with in-place batch transfer
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_CONTAINERS_SPSC_RING_HPP
+#define BIT_CONCURRENCY_CONTAINERS_SPSC_RING_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../locks/spinning_semaphore.hpp"
+
+#include "../utilities/cache_aligned.hpp"
+
+#include <atomic>      // std::atomic
+#include <cassert>
+#include <chrono>      // std::chrono::duration
+#include <cstddef>     // std::size_t
+#include <memory>      // std::unique_ptr
+#include <new>         // placement new
+#include <type_traits> // std::aligned_storage
+#include <utility>     // std::move
+
+namespace bit {
+  namespace concurrency {
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief The lines each side of a blocking spsc_ring parks on
+      ///
+      /// \tparam Blocking whether the ring is blocking
+      ////////////////////////////////////////////////////////////////////////
+      template<bool Blocking>
+      class spsc_ring_parking
+      {
+        //--------------------------------------------------------------------
+        // Protected Member Types
+        //--------------------------------------------------------------------
+      protected:
+
+        /// \brief The flag and semaphore one side parks on
+        struct parking_line
+        {
+          std::atomic<bool>  waiting{false};
+          spinning_semaphore semaphore{0};
+        };
+
+        //--------------------------------------------------------------------
+        // Protected Member Functions
+        //--------------------------------------------------------------------
+      protected:
+
+        /// \brief Wakes the consumer if it is parked
+        void notify_readable();
+
+        /// \brief Wakes the producer if it is parked
+        void notify_writable();
+
+        /// \brief Wakes the other side if it is parked on \p line
+        static void notify( parking_line& line );
+
+        //--------------------------------------------------------------------
+        // Protected Members
+        //--------------------------------------------------------------------
+      protected:
+
+        padded<parking_line> m_readable; ///< the consumer parks here
+        padded<parking_line> m_writable; ///< the producer parks here
+      };
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A non-blocking spsc_ring has nothing to park on, and nobody
+      ///        to wake
+      ////////////////////////////////////////////////////////////////////////
+      template<>
+      class spsc_ring_parking<false>
+      {
+      protected:
+
+        void notify_readable() noexcept;
+        void notify_writable() noexcept;
+      };
+
+    } // namespace detail
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A fixed-capacity ring buffer for exactly one producer and one
+    ///        consumer
+    ///
+    /// Every operation is wait-free. The producer writes elements directly
+    /// into the ring with \c try_reserve and publishes them with \c commit;
+    /// the consumer reads them in place with \c peek and releases them with
+    /// \c consume. Each side publishes its index once per batch rather than
+    /// once per element, and keeps a cached copy of the other side's index
+    /// so that it only reads the shared line when the cache runs out.
+    ///
+    /// When \p Blocking is \c true, \c reserve and \c wait_peek park on a
+    /// spinning_semaphore until space or data is available. This costs each
+    /// \c commit and \c consume a fence and a load; the non-blocking ring
+    /// pays nothing for it, and holds no parking state.
+    ///
+    /// \tparam T the element type
+    /// \tparam Blocking whether the blocking operations are available
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T, bool Blocking = false>
+    class spsc_ring
+      : private detail::spsc_ring_parking<Blocking>
+    {
+      template<typename Rep, typename Period>
+      using duration = std::chrono::duration<Rep,Period>;
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+      using size_type  = std::size_t;
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A contiguous range of cells in the ring
+      ////////////////////////////////////////////////////////////////////////
+      class span
+      {
+      public:
+
+        /// \brief Constructs an empty span
+        constexpr span() noexcept;
+
+        /// \brief Constructs a span of \p size cells starting at \p data
+        ///
+        /// \param data the first cell
+        /// \param size the number of cells
+        constexpr span( T* data, size_type size ) noexcept;
+
+        constexpr T* data() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr bool empty() const noexcept;
+
+        constexpr T* begin() const noexcept;
+        constexpr T* end() const noexcept;
+
+        T& operator[]( size_type index ) const noexcept;
+
+      private:
+
+        T*        m_data;
+        size_type m_size;
+      };
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty spsc_ring
+      ///
+      /// \param capacity the minimum capacity. Rounded up to a power of two
+      explicit spsc_ring( size_type capacity );
+
+      // Deleted copy constructor
+      spsc_ring( const spsc_ring& ) = delete;
+
+      // Deleted move constructor
+      spsc_ring( spsc_ring&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Destroys the ring and every committed element still in it
+      ~spsc_ring();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      spsc_ring& operator=( const spsc_ring& ) = delete;
+
+      // Deleted move assignment
+      spsc_ring& operator=( spsc_ring&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Capacity
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns the number of elements the ring can hold
+      ///
+      /// \return the capacity
+      size_type capacity() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Producer
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Reserves up to \p count contiguous free cells
+      ///
+      /// The cells are uninitialized storage: the producer must construct
+      /// each one it later commits with placement new. Fewer than \p count
+      /// cells are returned when the ring is nearly full, or when the free
+      /// cells wrap around the end of the ring.
+      ///
+      /// \param count the maximum number of cells to reserve
+      /// \return the reserved cells, which are empty if the ring is full
+      span try_reserve( size_type count ) noexcept;
+
+      /// \brief Reserves up to \p count contiguous free cells, waiting while
+      ///        the ring is full
+      ///
+      /// Only available when \p Blocking is \c true.
+      ///
+      /// \param count the maximum number of cells to reserve
+      /// \return the reserved cells, which are never empty
+      span reserve( size_type count );
+
+      /// \brief Publishes the first \p count reserved cells to the consumer
+      ///
+      /// \param count the number of constructed cells to publish
+      void commit( size_type count );
+
+      /// \brief Pushes a copy of \p value, unless the ring is full
+      ///
+      /// \param value the value to push
+      /// \return \c true if the value was pushed
+      bool try_push( const T& value );
+
+      /// \brief Pushes \p value, unless the ring is full
+      ///
+      /// \param value the value to push
+      /// \return \c true if the value was pushed
+      bool try_push( T&& value );
+
+      //----------------------------------------------------------------------
+      // Consumer
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns the contiguous committed elements at the front of
+      ///        the ring
+      ///
+      /// \return the readable elements, which are empty if the ring is empty
+      span peek() noexcept;
+
+      /// \brief Returns the contiguous committed elements at the front of
+      ///        the ring, waiting while the ring is empty
+      ///
+      /// Only available when \p Blocking is \c true.
+      ///
+      /// \return the readable elements, which are never empty
+      span wait_peek();
+
+      /// \brief Returns the contiguous committed elements at the front of
+      ///        the ring, waiting at most \p duration while the ring is empty
+      ///
+      /// Only available when \p Blocking is \c true.
+      ///
+      /// \param duration the maximum time to wait
+      /// \return the readable elements, which are empty on timeout
+      template<typename Rep, typename Period>
+      span wait_peek_for( const duration<Rep,Period>& duration );
+
+      /// \brief Destroys the first \p count peeked elements, and releases
+      ///        their cells to the producer
+      ///
+      /// \param count the number of elements to release
+      void consume( size_type count );
+
+      /// \brief Pops the front element into \p out, unless the ring is empty
+      ///
+      /// \param out the object to move the element into
+      /// \return \c true if an element was popped
+      bool try_pop( T& out );
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      using storage_type = typename std::aligned_storage<sizeof(T),alignof(T)>::type;
+
+      /// \brief The state written by the producer
+      struct producer_line
+      {
+        std::atomic<size_type> tail{0};
+        size_type head_cache = 0; ///< the producer's view of the head
+        size_type reserved   = 0; ///< the size of the last reservation
+      };
+
+      /// \brief The state written by the consumer
+      struct consumer_line
+      {
+        std::atomic<size_type> head{0};
+        size_type tail_cache = 0; ///< the consumer's view of the tail
+        size_type peeked     = 0; ///< the size of the last peek
+      };
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      padded<producer_line> m_producer;
+      padded<consumer_line> m_consumer;
+
+      std::unique_ptr<storage_type[]> m_buffer;
+      size_type                       m_mask;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      T* cell( size_type index ) const noexcept;
+
+      /// \brief Parks on \p line until \p poll returns a non-empty span
+      template<typename Line, typename Poll>
+      static span park( Line& line, Poll poll );
+
+      static size_type round_capacity( size_type capacity ) noexcept;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/spsc_ring.inl"
+
+#endif /* BIT_CONCURRENCY_CONTAINERS_SPSC_RING_HPP */
@@ -0,0 +1,167 @@
+/**
+ * \file work_stealing_deque.hpp
+ *
+ * \brief This header contains the Chase-Lev work-stealing deque
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_CONTAINERS_WORK_STEALING_DEQUE_HPP
+#define BIT_CONCURRENCY_CONTAINERS_WORK_STEALING_DEQUE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/cache_aligned.hpp"
+
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int64_t
+#include <memory>      // std::unique_ptr
+#include <type_traits> // std::is_trivially_copyable
+#include <vector>      // std::vector
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief An unbounded deque that one owner uses as a stack, and any
+    ///        number of thieves take from the other end
+    ///
+    /// This is the Chase-Lev deque, with the C11 memory orderings of Lê et
+    /// al., "Correct and Efficient Work-Stealing for Weak Memory Models".
+    /// The owner pushes and pops at the bottom (LIFO), which keeps recently
+    /// produced work in its cache and needs no atomic read-modify-write
+    /// except when taking the last element. Thieves steal from the top
+    /// (FIFO), where the oldest and typically largest work lies.
+    ///
+    /// The buffer doubles when full. Thieves may still be reading an old
+    /// buffer, so old buffers are kept until the deque is destroyed; as the
+    /// buffer grows geometrically, they never total more than the current
+    /// one.
+    ///
+    /// \tparam T the element type. Must be trivially copyable, since thieves
+    ///           read elements that the owner may concurrently overwrite
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class work_stealing_deque
+    {
+      static_assert( std::is_trivially_copyable<T>::value,
+                     "work_stealing_deque requires a trivially copyable type" );
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+      using size_type  = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty work_stealing_deque
+      ///
+      /// \param capacity the initial capacity. Rounded up to a power of two
+      explicit work_stealing_deque( size_type capacity = 256 );
+
+      // Deleted copy constructor
+      work_stealing_deque( const work_stealing_deque& ) = delete;
+
+      // Deleted move constructor
+      work_stealing_deque( work_stealing_deque&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      work_stealing_deque& operator=( const work_stealing_deque& ) = delete;
+
+      // Deleted move assignment
+      work_stealing_deque& operator=( work_stealing_deque&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Owner
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Pushes \p value onto the bottom of the deque
+      ///
+      /// Must only be called by the owner.
+      ///
+      /// \param value the value to push
+      void push( T value );
+
+      /// \brief Pops the most recently pushed element into \p out
+      ///
+      /// Must only be called by the owner.
+      ///
+      /// \param out the popped element
+      /// \return \c true if an element was popped
+      bool pop( T& out ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Thieves
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Steals the oldest element into \p out
+      ///
+      /// This also fails when another thread takes the same element first,
+      /// so \c false does not imply that the deque is empty.
+      ///
+      /// \param out the stolen element
+      /// \return \c true if an element was stolen
+      bool steal( T& out ) noexcept;
+
+      /// \brief Returns whether the deque appeared empty at some point during
+      ///        the call
+      ///
+      /// \return \c true if the deque was empty
+      bool empty() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      struct buffer
+      {
+        explicit buffer( std::int64_t capacity );
+
+        T    load( std::int64_t index ) const noexcept;
+        void store( std::int64_t index, T value ) noexcept;
+
+        std::int64_t                     mask;
+        std::unique_ptr<std::atomic<T>[]> cells;
+      };
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      padded<std::atomic<std::int64_t>> m_top; ///< the next index to steal
+
+      // Owner-written line
+      std::atomic<std::int64_t>    m_bottom; ///< the next index to push
+      padded<std::atomic<buffer*>> m_buffer;
+
+      std::vector<std::unique_ptr<buffer>> m_buffers; ///< owner access only
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Replaces the buffer with one twice its size
+      buffer* grow( buffer* old, std::int64_t top, std::int64_t bottom );
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/work_stealing_deque.inl"
+
+#endif /* BIT_CONCURRENCY_CONTAINERS_WORK_STEALING_DEQUE_HPP */
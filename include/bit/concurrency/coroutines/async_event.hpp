@@ -0,0 +1,200 @@
+/**
+ * \file async_event.hpp
+ *
+ * \brief This header contains an automatic and manual reset event that
+ *        suspends coroutines rather than blocking threads
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_COROUTINES_ASYNC_EVENT_HPP
+#define BIT_CONCURRENCY_COROUTINES_ASYNC_EVENT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/async_waiter.hpp"
+
+#include "../locks/spin_lock.hpp"
+#include "../locks/waitable_event.hpp"
+
+#include <atomic>    // std::atomic
+#include <coroutine> // std::coroutine_handle
+#include <cstdint>   // std::uint64_t
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief An event that is waited on with \c co_await
+    ///
+    /// This is the coroutine counterpart of waitable_event, and has the same
+    /// two modes:
+    ///
+    /// - reset_mode::automatic: each signal resumes exactly one waiter. If
+    ///   there are no waiters, the event stays signaled until the next
+    ///   waiter consumes it.
+    /// - reset_mode::manual: a signal resumes every waiter, and the event
+    ///   stays signaled until it is explicitly reset.
+    ///
+    /// Awaiting a signaled event does not take the lock. Waiters are queued
+    /// FIFO under a spin_lock, which is never held while one is resumed.
+    /// Signaling is a single compare-and-swap, and only takes the lock when
+    /// a waiter is queued, or is about to be; a coroutine that has not yet
+    /// suspended may therefore take an automatic-reset signal ahead of the
+    /// queued waiters.
+    ///
+    /// A released waiter is resumed inline from \c signal, unless it awaited
+    /// with an executor, in which case it is posted to that executor.
+    //////////////////////////////////////////////////////////////////////////
+    class async_event
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief The behaviour of the event once it has been signaled
+      using reset_mode = waitable_event::reset_mode;
+
+      /// \brief The awaitable returned from wait_async
+      class awaiter : private detail::async_waiter
+      {
+        friend async_event;
+
+      public:
+
+        explicit awaiter( async_event& event ) noexcept;
+
+        template<typename Executor>
+        awaiter( async_event& event, Executor& executor ) noexcept;
+
+        bool await_ready() noexcept;
+        bool await_suspend( std::coroutine_handle<> handle ) noexcept;
+        void await_resume() noexcept;
+
+      private:
+
+        async_event&  m_event;
+        std::uint64_t m_generation; ///< the signals seen before queueing
+      };
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an async_event that is not yet signaled
+      ///
+      /// \param mode the reset behaviour of this event
+      explicit async_event( reset_mode mode = reset_mode::automatic ) noexcept;
+
+      // Deleted copy constructor
+      async_event( const async_event& ) = delete;
+
+      // Deleted move constructor
+      async_event( async_event&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Destroys the event, which must have no waiters
+      ~async_event();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      async_event& operator=( const async_event& ) = delete;
+
+      // Deleted move assignment
+      async_event& operator=( async_event&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Waiting
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns an awaitable that completes once the event is
+      ///        signaled
+      ///
+      /// \return the awaitable
+      awaiter wait_async() noexcept;
+
+      /// \brief Returns an awaitable that completes once the event is
+      ///        signaled, resuming on \p executor if the coroutine had to
+      ///        wait
+      ///
+      /// \param executor an executor with a \c post(Fn) member
+      /// \return the awaitable
+      template<typename Executor>
+      awaiter wait_async( Executor& executor ) noexcept;
+
+      /// \brief Checks whether the event is signaled without suspending
+      ///
+      /// An automatic-reset event is reset if this succeeds.
+      ///
+      /// \return \c true if the event was signaled
+      bool try_wait() noexcept;
+
+      //----------------------------------------------------------------------
+      // Signaling
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Signals this async_event
+      ///
+      /// An automatic-reset event resumes at most one waiter; a manual-reset
+      /// event resumes all current waiters.
+      void signal();
+
+      /// \brief Resets this async_event to the non-signaled state
+      void reset() noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the reset behaviour of this event
+      ///
+      /// \return the reset mode
+      reset_mode mode() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      // Bit 0 is set while the event is signaled, and the other bits count
+      // the signals, so that a manual-reset signal only resumes the waiters
+      // that queued before it, even if the event is reset and waited on
+      // again before it takes the lock.
+      //
+      // A waiter counts itself in 'm_waiters' before its last check of the
+      // state, and a signal reads 'm_waiters' after updating it. With a
+      // fence on each side, either the waiter sees the signal, or the
+      // signal sees the waiter and takes the lock to resume it.
+      std::atomic<std::uint64_t> m_state;
+      std::atomic<int>           m_waiters; ///< written under 'm_lock'
+      reset_mode                 m_mode;
+      spin_lock                  m_lock;
+      detail::async_waiter*      m_head;
+      detail::async_waiter*      m_tail;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Checks whether the event is signaled, as try_wait does
+      ///
+      /// \param generation set to the number of signals seen
+      /// \return \c true if the event was signaled
+      bool try_wait( std::uint64_t& generation ) noexcept;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/async_event.inl"
+
+#endif /* BIT_CONCURRENCY_COROUTINES_ASYNC_EVENT_HPP */
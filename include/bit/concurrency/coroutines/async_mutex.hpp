@@ -0,0 +1,142 @@
+/**
+ * \file async_mutex.hpp
+ *
+ * \brief This header contains a mutex that suspends coroutines rather than
+ *        blocking threads
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_COROUTINES_ASYNC_MUTEX_HPP
+#define BIT_CONCURRENCY_COROUTINES_ASYNC_MUTEX_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/async_waiter.hpp"
+
+#include <atomic>    // std::atomic
+#include <coroutine> // std::coroutine_handle
+#include <cstdint>   // std::uintptr_t
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A mutex that is acquired with \c co_await
+    ///
+    /// \code
+    /// co_await mutex.lock_async();
+    /// std::lock_guard<async_mutex> guard{ mutex, std::adopt_lock };
+    /// \endcode
+    ///
+    /// The mutex is a single atomic word, and is lock-free: a coroutine that
+    /// finds it locked pushes itself onto a stack of new waiters. unlock
+    /// hands the mutex directly to the longest waiting coroutine, so waiters
+    /// are served in FIFO order and the lock is never stolen from a woken
+    /// waiter.
+    ///
+    /// The next owner is resumed inline from \c unlock, unless it awaited
+    /// with an executor, in which case it is posted to that executor.
+    //////////////////////////////////////////////////////////////////////////
+    class async_mutex
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief The awaitable returned from lock_async
+      class awaiter : private detail::async_waiter
+      {
+        friend async_mutex;
+
+      public:
+
+        explicit awaiter( async_mutex& mutex ) noexcept;
+
+        template<typename Executor>
+        awaiter( async_mutex& mutex, Executor& executor ) noexcept;
+
+        bool await_ready() noexcept;
+        bool await_suspend( std::coroutine_handle<> handle ) noexcept;
+        void await_resume() noexcept;
+
+      private:
+
+        async_mutex& m_mutex;
+      };
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an unlocked async_mutex
+      async_mutex() noexcept;
+
+      // Deleted copy constructor
+      async_mutex( const async_mutex& ) = delete;
+
+      // Deleted move constructor
+      async_mutex( async_mutex&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Destroys the mutex, which must be unlocked
+      ~async_mutex();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      async_mutex& operator=( const async_mutex& ) = delete;
+
+      // Deleted move assignment
+      async_mutex& operator=( async_mutex&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Locking
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns an awaitable that completes once the mutex is held
+      ///
+      /// \return the awaitable
+      awaiter lock_async() noexcept;
+
+      /// \brief Returns an awaitable that completes once the mutex is held,
+      ///        resuming on \p executor if the coroutine had to wait
+      ///
+      /// \param executor an executor with a \c post(Fn) member
+      /// \return the awaitable
+      template<typename Executor>
+      awaiter lock_async( Executor& executor ) noexcept;
+
+      /// \brief Tries to lock the mutex without suspending
+      ///
+      /// \return \c true if the mutex is now held
+      bool try_lock() noexcept;
+
+      /// \brief Unlocks the mutex, handing it to the next waiter if any
+      void unlock();
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      static constexpr std::uintptr_t not_locked = 1;
+
+      // 'not_locked' when unlocked, 0 when locked with no new waiters, or
+      // the newest waiter on a stack of waiters not yet moved to 'm_waiters'
+      std::atomic<std::uintptr_t> m_state;
+
+      detail::async_waiter* m_waiters; ///< FIFO, owned by the holder
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/async_mutex.inl"
+
+#endif /* BIT_CONCURRENCY_COROUTINES_ASYNC_MUTEX_HPP */
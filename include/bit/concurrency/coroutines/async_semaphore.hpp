@@ -0,0 +1,154 @@
+/**
+ * \file async_semaphore.hpp
+ *
+ * \brief This header contains a counting semaphore that suspends coroutines
+ *        rather than blocking threads
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_COROUTINES_ASYNC_SEMAPHORE_HPP
+#define BIT_CONCURRENCY_COROUTINES_ASYNC_SEMAPHORE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/async_waiter.hpp"
+
+#include "../locks/spin_lock.hpp"
+
+#include <atomic>    // std::atomic
+#include <coroutine> // std::coroutine_handle
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A counting semaphore that is waited on with \c co_await
+    ///
+    /// This is the coroutine counterpart of semaphore. Taking an available
+    /// count is a single compare-and-swap; a coroutine that finds none is
+    /// queued FIFO under a spin_lock, which is only held to link and unlink
+    /// waiters and never while one is resumed. Signaling is an atomic add,
+    /// and only takes the lock when a waiter is queued, or is about to be.
+    ///
+    /// Released entries are banked before queued waiters are resumed, so a
+    /// coroutine that has not yet suspended may take one ahead of them.
+    ///
+    /// A released waiter is resumed inline from \c signal, unless it awaited
+    /// with an executor, in which case it is posted to that executor.
+    //////////////////////////////////////////////////////////////////////////
+    class async_semaphore
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief The awaitable returned from wait_async
+      class awaiter : private detail::async_waiter
+      {
+        friend async_semaphore;
+
+      public:
+
+        explicit awaiter( async_semaphore& semaphore ) noexcept;
+
+        template<typename Executor>
+        awaiter( async_semaphore& semaphore, Executor& executor ) noexcept;
+
+        bool await_ready() noexcept;
+        bool await_suspend( std::coroutine_handle<> handle ) noexcept;
+        void await_resume() noexcept;
+
+      private:
+
+        async_semaphore& m_semaphore;
+      };
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an async_semaphore with \p count available entries
+      ///
+      /// \param count the initial count
+      explicit async_semaphore( int count = 0 ) noexcept;
+
+      // Deleted copy constructor
+      async_semaphore( const async_semaphore& ) = delete;
+
+      // Deleted move constructor
+      async_semaphore( async_semaphore&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Destroys the semaphore, which must have no waiters
+      ~async_semaphore();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      async_semaphore& operator=( const async_semaphore& ) = delete;
+
+      // Deleted move assignment
+      async_semaphore& operator=( async_semaphore&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Waiting
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns an awaitable that completes once an entry has been
+      ///        taken
+      ///
+      /// \return the awaitable
+      awaiter wait_async() noexcept;
+
+      /// \brief Returns an awaitable that completes once an entry has been
+      ///        taken, resuming on \p executor if the coroutine had to wait
+      ///
+      /// \param executor an executor with a \c post(Fn) member
+      /// \return the awaitable
+      template<typename Executor>
+      awaiter wait_async( Executor& executor ) noexcept;
+
+      /// \brief Tries to take an entry without suspending
+      ///
+      /// \return \c true if an entry was taken
+      bool try_wait() noexcept;
+
+      //----------------------------------------------------------------------
+      // Signaling
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Releases \p count entries, resuming up to \p count waiters
+      ///
+      /// \param count the number of entries to release
+      void signal( int count = 1 );
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      // A waiter counts itself in 'm_waiters' before its last attempt to
+      // take an entry, and a signal reads 'm_waiters' after banking its
+      // entries. With a fence on each side, either the waiter sees the
+      // entries, or the signal sees the waiter and takes the lock to
+      // resume it.
+      std::atomic<int>      m_count;
+      std::atomic<int>      m_waiters; ///< written under 'm_lock'
+      spin_lock             m_lock;
+      detail::async_waiter* m_head;
+      detail::async_waiter* m_tail;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/async_semaphore.inl"
+
+#endif /* BIT_CONCURRENCY_COROUTINES_ASYNC_SEMAPHORE_HPP */
@@ -0,0 +1,232 @@
+#ifndef BIT_CONCURRENCY_COROUTINES_DETAIL_ASYNC_EVENT_INL
+#define BIT_CONCURRENCY_COROUTINES_DETAIL_ASYNC_EVENT_INL
+
+#include <cassert> // assert
+#include <mutex>   // std::lock_guard
+
+//============================================================================
+// async_event::awaiter
+//============================================================================
+
+inline bit::concurrency::async_event::awaiter::awaiter( async_event& event )
+  noexcept
+  : async_waiter(),
+    m_event(event),
+    m_generation(0)
+{
+
+}
+
+template<typename Executor>
+inline bit::concurrency::async_event::awaiter
+  ::awaiter( async_event& event, Executor& executor )
+  noexcept
+  : async_waiter(executor),
+    m_event(event),
+    m_generation(0)
+{
+
+}
+
+inline bool bit::concurrency::async_event::awaiter::await_ready()
+  noexcept
+{
+  return m_event.try_wait();
+}
+
+inline bool bit::concurrency::async_event::awaiter
+  ::await_suspend( std::coroutine_handle<> handle )
+  noexcept
+{
+  this->handle = handle;
+
+  std::lock_guard<spin_lock> lock{ m_event.m_lock };
+
+  m_event.m_waiters.fetch_add(1, std::memory_order_relaxed);
+
+  // Pairs with the fence in 'signal'
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  // The event may have been signaled since 'await_ready'
+  if( m_event.try_wait( m_generation ) ) {
+    m_event.m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  if( m_event.m_tail == nullptr ) {
+    m_event.m_head = this;
+  } else {
+    m_event.m_tail->next = this;
+  }
+  m_event.m_tail = this;
+
+  return true;
+}
+
+inline void bit::concurrency::async_event::awaiter::await_resume()
+  noexcept
+{
+
+}
+
+//============================================================================
+// async_event
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor / Destructor
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::async_event::async_event( reset_mode mode )
+  noexcept
+  : m_state(0),
+    m_waiters(0),
+    m_mode(mode),
+    m_lock(),
+    m_head(nullptr),
+    m_tail(nullptr)
+{
+
+}
+
+inline bit::concurrency::async_event::~async_event()
+{
+  assert( m_head == nullptr && "async_event destroyed with waiters" );
+}
+
+//----------------------------------------------------------------------------
+// Waiting
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::async_event::awaiter
+  bit::concurrency::async_event::wait_async()
+  noexcept
+{
+  return awaiter{ *this };
+}
+
+template<typename Executor>
+inline bit::concurrency::async_event::awaiter
+  bit::concurrency::async_event::wait_async( Executor& executor )
+  noexcept
+{
+  return awaiter{ *this, executor };
+}
+
+inline bool bit::concurrency::async_event::try_wait()
+  noexcept
+{
+  auto generation = std::uint64_t(0);
+
+  return try_wait( generation );
+}
+
+//----------------------------------------------------------------------------
+// Signaling
+//----------------------------------------------------------------------------
+
+inline void bit::concurrency::async_event::signal()
+{
+  auto state = m_state.load(std::memory_order_relaxed);
+
+  // Sets the signaled bit, and counts the signal
+  while( !m_state.compare_exchange_weak( state, (state | 1u) + 2u,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed ) ) {
+    // 'state' is reloaded with the current value
+  }
+  const auto generation = ((state | 1u) + 2u) >> 1;
+
+  // Pairs with the fence in 'await_suspend'
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if( m_waiters.load(std::memory_order_relaxed) == 0 ) {
+    return;
+  }
+
+  auto* released = static_cast<detail::async_waiter*>(nullptr);
+
+  {
+    std::lock_guard<spin_lock> lock{ m_lock };
+
+    released = m_head;
+
+    auto* last = static_cast<detail::async_waiter*>(nullptr);
+
+    if( m_mode == reset_mode::manual ) {
+      // Waiters are queued in order, so the ones that queued before this
+      // signal are a prefix of the queue
+      while( m_head != nullptr &&
+             static_cast<awaiter*>(m_head)->m_generation < generation ) {
+        last   = m_head;
+        m_head = m_head->next;
+        m_waiters.fetch_sub(1, std::memory_order_relaxed);
+      }
+    } else if( m_head != nullptr && try_wait() ) {
+      // Take the signal back for the oldest waiter; it may already have
+      // gone to a coroutine that never suspended
+      last   = m_head;
+      m_head = m_head->next;
+      m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    if( last == nullptr ) {
+      released = nullptr;
+    } else {
+      last->next = nullptr;
+    }
+    if( m_head == nullptr ) {
+      m_tail = nullptr;
+    }
+  }
+
+  // Waiters are resumed outside of the lock, since a resumed coroutine may
+  // wait on this event again
+  while( released != nullptr ) {
+    auto* next = released->next;
+    released->resume();
+    released = next;
+  }
+}
+
+inline void bit::concurrency::async_event::reset()
+  noexcept
+{
+  m_state.fetch_and(~std::uint64_t(1), std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::async_event::reset_mode
+  bit::concurrency::async_event::mode()
+  const noexcept
+{
+  return m_mode;
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+inline bool bit::concurrency::async_event::try_wait( std::uint64_t& generation )
+  noexcept
+{
+  auto state = m_state.load(std::memory_order_acquire);
+
+  if( m_mode == reset_mode::automatic ) {
+    while( (state & 1u) != 0 ) {
+      if( m_state.compare_exchange_weak( state, state & ~std::uint64_t(1),
+                                         std::memory_order_acquire,
+                                         std::memory_order_acquire ) ) {
+        return true;
+      }
+    }
+  }
+
+  generation = state >> 1;
+  return (state & 1u) != 0;
+}
+
+#endif /* BIT_CONCURRENCY_COROUTINES_DETAIL_ASYNC_EVENT_INL */
@@ -0,0 +1,157 @@
+#ifndef BIT_CONCURRENCY_COROUTINES_DETAIL_ASYNC_MUTEX_INL
+#define BIT_CONCURRENCY_COROUTINES_DETAIL_ASYNC_MUTEX_INL
+
+#include <cassert> // assert
+
+//============================================================================
+// async_mutex::awaiter
+//============================================================================
+
+inline bit::concurrency::async_mutex::awaiter::awaiter( async_mutex& mutex )
+  noexcept
+  : async_waiter(),
+    m_mutex(mutex)
+{
+
+}
+
+template<typename Executor>
+inline bit::concurrency::async_mutex::awaiter
+  ::awaiter( async_mutex& mutex, Executor& executor )
+  noexcept
+  : async_waiter(executor),
+    m_mutex(mutex)
+{
+
+}
+
+inline bool bit::concurrency::async_mutex::awaiter::await_ready()
+  noexcept
+{
+  return m_mutex.try_lock();
+}
+
+inline bool bit::concurrency::async_mutex::awaiter
+  ::await_suspend( std::coroutine_handle<> handle )
+  noexcept
+{
+  this->handle = handle;
+
+  auto state = m_mutex.m_state.load(std::memory_order_relaxed);
+
+  while( true ) {
+    if( state == not_locked ) {
+      // Unlocked since 'await_ready'; take it without suspending
+      if( m_mutex.m_state.compare_exchange_weak( state, 0,
+                                                 std::memory_order_acquire,
+                                                 std::memory_order_relaxed ) ) {
+        return false;
+      }
+      continue;
+    }
+
+    next = reinterpret_cast<detail::async_waiter*>(state);
+    const auto self = reinterpret_cast<std::uintptr_t>(
+      static_cast<detail::async_waiter*>(this)
+    );
+
+    // Release, so that the holder that pops this waiter sees 'handle'
+    if( m_mutex.m_state.compare_exchange_weak( state, self,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed ) ) {
+      return true;
+    }
+  }
+}
+
+inline void bit::concurrency::async_mutex::awaiter::await_resume()
+  noexcept
+{
+
+}
+
+//============================================================================
+// async_mutex
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor / Destructor
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::async_mutex::async_mutex()
+  noexcept
+  : m_state(not_locked),
+    m_waiters(nullptr)
+{
+
+}
+
+inline bit::concurrency::async_mutex::~async_mutex()
+{
+  assert( m_state.load(std::memory_order_relaxed) == not_locked &&
+          "async_mutex destroyed while locked" );
+}
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::async_mutex::awaiter
+  bit::concurrency::async_mutex::lock_async()
+  noexcept
+{
+  return awaiter{ *this };
+}
+
+template<typename Executor>
+inline bit::concurrency::async_mutex::awaiter
+  bit::concurrency::async_mutex::lock_async( Executor& executor )
+  noexcept
+{
+  return awaiter{ *this, executor };
+}
+
+inline bool bit::concurrency::async_mutex::try_lock()
+  noexcept
+{
+  auto expected = not_locked;
+
+  return m_state.compare_exchange_strong( expected, 0,
+                                          std::memory_order_acquire,
+                                          std::memory_order_relaxed );
+}
+
+inline void bit::concurrency::async_mutex::unlock()
+{
+  assert( m_state.load(std::memory_order_relaxed) != not_locked );
+
+  auto* head = m_waiters;
+
+  if( head == nullptr ) {
+    auto expected = std::uintptr_t(0);
+
+    if( m_state.compare_exchange_strong( expected, not_locked,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed ) ) {
+      return;
+    }
+
+    // New waiters arrived; take the whole stack, leaving the mutex locked,
+    // and reverse it into arrival order
+    auto state = m_state.exchange(0, std::memory_order_acquire);
+    auto* stack = reinterpret_cast<detail::async_waiter*>(state);
+
+    do {
+      auto* next  = stack->next;
+      stack->next = head;
+      head  = stack;
+      stack = next;
+    } while( stack != nullptr );
+  }
+
+  // Ownership passes to 'head' without the mutex ever becoming unlocked
+  m_waiters = head->next;
+  head->resume();
+}
+
+#endif /* BIT_CONCURRENCY_COROUTINES_DETAIL_ASYNC_MUTEX_INL */
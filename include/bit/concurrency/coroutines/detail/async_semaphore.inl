@@ -0,0 +1,179 @@
+#ifndef BIT_CONCURRENCY_COROUTINES_DETAIL_ASYNC_SEMAPHORE_INL
+#define BIT_CONCURRENCY_COROUTINES_DETAIL_ASYNC_SEMAPHORE_INL
+
+#include <cassert> // assert
+#include <mutex>   // std::lock_guard
+
+//============================================================================
+// async_semaphore::awaiter
+//============================================================================
+
+inline bit::concurrency::async_semaphore::awaiter
+  ::awaiter( async_semaphore& semaphore )
+  noexcept
+  : async_waiter(),
+    m_semaphore(semaphore)
+{
+
+}
+
+template<typename Executor>
+inline bit::concurrency::async_semaphore::awaiter
+  ::awaiter( async_semaphore& semaphore, Executor& executor )
+  noexcept
+  : async_waiter(executor),
+    m_semaphore(semaphore)
+{
+
+}
+
+inline bool bit::concurrency::async_semaphore::awaiter::await_ready()
+  noexcept
+{
+  return m_semaphore.try_wait();
+}
+
+inline bool bit::concurrency::async_semaphore::awaiter
+  ::await_suspend( std::coroutine_handle<> handle )
+  noexcept
+{
+  this->handle = handle;
+
+  std::lock_guard<spin_lock> lock{ m_semaphore.m_lock };
+
+  m_semaphore.m_waiters.fetch_add(1, std::memory_order_relaxed);
+
+  // Pairs with the fence in 'signal'
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  // An entry may have been released since 'await_ready'
+  if( m_semaphore.try_wait() ) {
+    m_semaphore.m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  if( m_semaphore.m_tail == nullptr ) {
+    m_semaphore.m_head = this;
+  } else {
+    m_semaphore.m_tail->next = this;
+  }
+  m_semaphore.m_tail = this;
+
+  return true;
+}
+
+inline void bit::concurrency::async_semaphore::awaiter::await_resume()
+  noexcept
+{
+
+}
+
+//============================================================================
+// async_semaphore
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor / Destructor
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::async_semaphore::async_semaphore( int count )
+  noexcept
+  : m_count(count),
+    m_waiters(0),
+    m_lock(),
+    m_head(nullptr),
+    m_tail(nullptr)
+{
+
+}
+
+inline bit::concurrency::async_semaphore::~async_semaphore()
+{
+  assert( m_head == nullptr && "async_semaphore destroyed with waiters" );
+}
+
+//----------------------------------------------------------------------------
+// Waiting
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::async_semaphore::awaiter
+  bit::concurrency::async_semaphore::wait_async()
+  noexcept
+{
+  return awaiter{ *this };
+}
+
+template<typename Executor>
+inline bit::concurrency::async_semaphore::awaiter
+  bit::concurrency::async_semaphore::wait_async( Executor& executor )
+  noexcept
+{
+  return awaiter{ *this, executor };
+}
+
+inline bool bit::concurrency::async_semaphore::try_wait()
+  noexcept
+{
+  auto count = m_count.load(std::memory_order_relaxed);
+
+  while( count > 0 ) {
+    if( m_count.compare_exchange_weak( count, count - 1,
+                                       std::memory_order_acquire,
+                                       std::memory_order_relaxed ) ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------------
+// Signaling
+//----------------------------------------------------------------------------
+
+inline void bit::concurrency::async_semaphore::signal( int count )
+{
+  m_count.fetch_add(count, std::memory_order_release);
+
+  // Pairs with the fence in 'await_suspend'
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if( m_waiters.load(std::memory_order_relaxed) == 0 ) {
+    return;
+  }
+
+  auto* released = static_cast<detail::async_waiter*>(nullptr);
+
+  {
+    std::lock_guard<spin_lock> lock{ m_lock };
+
+    // Take back banked entries for the oldest waiters; some may already
+    // have gone to coroutines that never suspended
+    released = m_head;
+
+    auto* last = static_cast<detail::async_waiter*>(nullptr);
+    while( m_head != nullptr && try_wait() ) {
+      last   = m_head;
+      m_head = m_head->next;
+      m_waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    if( last == nullptr ) {
+      released = nullptr;
+    } else {
+      last->next = nullptr;
+    }
+    if( m_head == nullptr ) {
+      m_tail = nullptr;
+    }
+  }
+
+  // Waiters are resumed outside of the lock, since a resumed coroutine may
+  // wait on this semaphore again
+  while( released != nullptr ) {
+    auto* next = released->next;
+    released->resume();
+    released = next;
+  }
+}
+
+#endif /* BIT_CONCURRENCY_COROUTINES_DETAIL_ASYNC_SEMAPHORE_INL */
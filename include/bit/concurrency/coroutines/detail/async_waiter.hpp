@@ -0,0 +1,117 @@
+/**
+ * \file async_waiter.hpp
+ *
+ * \brief This header contains the intrusive waiter node shared by the
+ *        coroutine synchronization primitives
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_COROUTINES_DETAIL_ASYNC_WAITER_HPP
+#define BIT_CONCURRENCY_COROUTINES_DETAIL_ASYNC_WAITER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#if !defined(__cpp_impl_coroutine)
+# error "bit::concurrency coroutine primitives require C++20 coroutines"
+#endif
+
+#include <coroutine> // std::coroutine_handle
+
+namespace bit {
+  namespace concurrency {
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A suspended coroutine, queued intrusively
+      ///
+      /// Awaiters derive from this, so the node lives in the awaiting
+      /// coroutine's frame and suspending never allocates. A waiter is either
+      /// resumed inline, on the thread that releases it, or posted to an
+      /// executor supplied when it was created.
+      ////////////////////////////////////////////////////////////////////////
+      struct async_waiter
+      {
+        /// \brief Constructs a waiter that is resumed inline
+        async_waiter() noexcept;
+
+        /// \brief Constructs a waiter that is resumed by posting to
+        ///        \p executor
+        ///
+        /// \param executor an executor with a \c post(Fn) member
+        template<typename Executor>
+        explicit async_waiter( Executor& executor ) noexcept;
+
+        // Deleted copy constructor
+        async_waiter( const async_waiter& ) = delete;
+
+        // Deleted copy assignment
+        async_waiter& operator=( const async_waiter& ) = delete;
+
+        /// \brief Resumes the suspended coroutine
+        ///
+        /// The waiter may be destroyed as soon as this starts, since it lives
+        /// in the frame of the coroutine being resumed.
+        void resume();
+
+        async_waiter*           next;
+        std::coroutine_handle<> handle;
+        void (*resume_fn)( async_waiter* );
+        void*                   executor;
+      };
+
+      //----------------------------------------------------------------------
+      // Resumption
+      //----------------------------------------------------------------------
+
+      inline void resume_inline( async_waiter* waiter )
+      {
+        waiter->handle.resume();
+      }
+
+      template<typename Executor>
+      inline void resume_on_executor( async_waiter* waiter )
+      {
+        auto* executor = static_cast<Executor*>(waiter->executor);
+        auto handle    = waiter->handle;
+
+        executor->post( [handle]{ handle.resume(); } );
+      }
+
+    } // namespace detail
+  } // namespace concurrency
+} // namespace bit
+
+//============================================================================
+// Inline Definitions : async_waiter
+//============================================================================
+
+inline bit::concurrency::detail::async_waiter::async_waiter()
+  noexcept
+  : next(nullptr),
+    handle(),
+    resume_fn(&resume_inline),
+    executor(nullptr)
+{
+
+}
+
+template<typename Executor>
+inline bit::concurrency::detail::async_waiter
+  ::async_waiter( Executor& executor )
+  noexcept
+  : next(nullptr),
+    handle(),
+    resume_fn(&resume_on_executor<Executor>),
+    executor(static_cast<void*>(&executor))
+{
+
+}
+
+inline void bit::concurrency::detail::async_waiter::resume()
+{
+  resume_fn( this );
+}
+
+#endif /* BIT_CONCURRENCY_COROUTINES_DETAIL_ASYNC_WAITER_HPP */
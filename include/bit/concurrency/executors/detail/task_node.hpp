@@ -0,0 +1,148 @@
+/**
+ * \file task_node.hpp
+ *
+ * \brief This header contains the type-erased, recycled task storage used by
+ *        the executors
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_EXECUTORS_DETAIL_TASK_NODE_HPP
+#define BIT_CONCURRENCY_EXECUTORS_DETAIL_TASK_NODE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <cstddef>     // std::size_t, std::max_align_t
+#include <new>         // placement new
+#include <type_traits> // std::aligned_storage, std::decay, std::integral_constant
+#include <utility>     // std::forward
+
+namespace bit {
+  namespace concurrency {
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A nullary callable, stored in place when it is small enough
+      ///
+      /// Nodes are recycled through a bounded cache local to the releasing
+      /// thread, so that posting a small callable does not allocate once the
+      /// cache is warm.
+      ////////////////////////////////////////////////////////////////////////
+      struct task_node
+      {
+        static constexpr std::size_t buffer_size = 6 * sizeof(void*);
+
+        using storage_type = std::aligned_storage<buffer_size,alignof(std::max_align_t)>::type;
+
+        storage_type storage;
+
+        /// Invokes the callable, and then destroys it
+        void (*run)( task_node* );
+
+        task_node* cache_next;
+      };
+
+      /// \brief Takes a node from the calling thread's cache, allocating one
+      ///        if the cache is empty
+      ///
+      /// \return the node
+      task_node* acquire_task_node();
+
+      /// \brief Returns \p node to the calling thread's cache, or frees it if
+      ///        the cache is full
+      ///
+      /// \param node the node, whose callable has already been destroyed
+      void release_task_node( task_node* node ) noexcept;
+
+      /// \brief Stores \p fn in a node
+      ///
+      /// \param fn the callable to store
+      /// \return the node
+      template<typename Fn>
+      task_node* make_task_node( Fn&& fn );
+
+    } // namespace detail
+  } // namespace concurrency
+} // namespace bit
+
+//============================================================================
+// Inline Definitions : task_node
+//============================================================================
+
+namespace bit {
+  namespace concurrency {
+    namespace detail {
+
+      template<typename Callable>
+      inline void run_inline_task( task_node* node )
+      {
+        auto* callable = reinterpret_cast<Callable*>(&node->storage);
+
+        struct destroyer
+        {
+          ~destroyer(){ callable->~Callable(); }
+          Callable* callable;
+        } guard{ callable };
+
+        (*callable)();
+      }
+
+      template<typename Callable>
+      inline void run_heap_task( task_node* node )
+      {
+        auto* callable = *reinterpret_cast<Callable**>(&node->storage);
+
+        struct destroyer
+        {
+          ~destroyer(){ delete callable; }
+          Callable* callable;
+        } guard{ callable };
+
+        (*callable)();
+      }
+
+      template<typename Fn>
+      inline void emplace_task( task_node* node, Fn&& fn, std::true_type )
+      {
+        using callable_type = typename std::decay<Fn>::type;
+
+        ::new (static_cast<void*>(&node->storage)) callable_type( std::forward<Fn>(fn) );
+        node->run = &run_inline_task<callable_type>;
+      }
+
+      template<typename Fn>
+      inline void emplace_task( task_node* node, Fn&& fn, std::false_type )
+      {
+        using callable_type = typename std::decay<Fn>::type;
+
+        auto* callable = new callable_type( std::forward<Fn>(fn) );
+        ::new (static_cast<void*>(&node->storage)) callable_type*( callable );
+        node->run = &run_heap_task<callable_type>;
+      }
+
+      template<typename Fn>
+      inline task_node* make_task_node( Fn&& fn )
+      {
+        using callable_type = typename std::decay<Fn>::type;
+        using fits = std::integral_constant<bool,
+          sizeof(callable_type) <= task_node::buffer_size &&
+          alignof(callable_type) <= alignof(std::max_align_t)
+        >;
+
+        auto* node = acquire_task_node();
+
+        try {
+          emplace_task( node, std::forward<Fn>(fn), fits{} );
+        } catch( ... ) {
+          release_task_node( node );
+          throw;
+        }
+        return node;
+      }
+
+    } // namespace detail
+  } // namespace concurrency
+} // namespace bit
+
+#endif /* BIT_CONCURRENCY_EXECUTORS_DETAIL_TASK_NODE_HPP */
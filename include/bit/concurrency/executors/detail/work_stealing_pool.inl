@@ -0,0 +1,36 @@
+#ifndef BIT_CONCURRENCY_EXECUTORS_DETAIL_WORK_STEALING_POOL_INL
+#define BIT_CONCURRENCY_EXECUTORS_DETAIL_WORK_STEALING_POOL_INL
+
+//----------------------------------------------------------------------------
+// Submission
+//----------------------------------------------------------------------------
+
+template<typename Fn>
+inline void bit::concurrency::work_stealing_pool::post( Fn&& fn )
+{
+  schedule( detail::make_task_node( std::forward<Fn>(fn) ) );
+}
+
+template<typename Fn>
+inline std::future<bit::concurrency::work_stealing_pool::invoke_result<Fn>>
+  bit::concurrency::work_stealing_pool::submit( Fn&& fn )
+{
+  auto task   = std::packaged_task<invoke_result<Fn>()>( std::forward<Fn>(fn) );
+  auto future = task.get_future();
+
+  post( std::move(task) );
+
+  return future;
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline std::size_t bit::concurrency::work_stealing_pool::size()
+  const noexcept
+{
+  return m_workers.size();
+}
+
+#endif /* BIT_CONCURRENCY_EXECUTORS_DETAIL_WORK_STEALING_POOL_INL */
@@ -0,0 +1,197 @@
+/**
+ * \file work_stealing_pool.hpp
+ *
+ * \brief This header contains a work-stealing thread pool
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_EXECUTORS_WORK_STEALING_POOL_HPP
+#define BIT_CONCURRENCY_EXECUTORS_WORK_STEALING_POOL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/task_node.hpp"
+
+#include "../containers/mpmc_queue.hpp"
+#include "../containers/work_stealing_deque.hpp"
+#include "../locks/eventcount.hpp"
+
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <future>      // std::future, std::packaged_task
+#include <memory>      // std::unique_ptr
+#include <thread>      // std::thread
+#include <type_traits> // std::decay
+#include <utility>     // std::declval, std::forward
+#include <vector>      // std::vector
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A fixed-size thread pool in which idle workers steal work from
+    ///        busy ones
+    ///
+    /// Each worker owns a work_stealing_deque. Work posted from a worker goes
+    /// to the bottom of its own deque and is popped LIFO, so recursive
+    /// fork-join work stays in the cache of the thread that produced it.
+    /// A worker whose deque is empty takes work posted from outside the
+    /// pool, and then steals FIFO from the top of the other workers' deques,
+    /// starting at a random victim so that thieves spread out.
+    ///
+    /// Workers that find no work park on an eventcount. Posting only pays
+    /// for a fence and a load unless a worker is actually asleep.
+    ///
+    /// Callables up to detail::task_node::buffer_size bytes are stored in
+    /// recycled nodes, so posting them does not allocate once the node cache
+    /// is warm.
+    ///
+    /// The destructor runs every task posted before it, and then joins the
+    /// workers.
+    //////////////////////////////////////////////////////////////////////////
+    class work_stealing_pool
+    {
+      template<typename Fn>
+      using invoke_result = decltype(std::declval<typename std::decay<Fn>::type&>()());
+
+      //----------------------------------------------------------------------
+      // Public Static Members
+      //----------------------------------------------------------------------
+    public:
+
+      static constexpr std::size_t default_queue_capacity = 1024;
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a pool with one worker per hardware thread
+      work_stealing_pool();
+
+      /// \brief Constructs a pool with \p threads workers
+      ///
+      /// \param threads the number of workers. At least one is started
+      /// \param queue_capacity the capacity of the queue of work posted from
+      ///                       outside the pool
+      explicit work_stealing_pool( std::size_t threads,
+                                   std::size_t queue_capacity = default_queue_capacity );
+
+      // Deleted copy constructor
+      work_stealing_pool( const work_stealing_pool& ) = delete;
+
+      // Deleted move constructor
+      work_stealing_pool( work_stealing_pool&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Runs all outstanding work, and joins the workers
+      ///
+      /// Must not be called from a worker of this pool.
+      ~work_stealing_pool();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      work_stealing_pool& operator=( const work_stealing_pool& ) = delete;
+
+      // Deleted move assignment
+      work_stealing_pool& operator=( work_stealing_pool&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Submission
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Schedules \p fn to be invoked on a worker
+      ///
+      /// \p fn must not throw. When called from outside the pool, this waits
+      /// while the external queue is full.
+      ///
+      /// \param fn the nullary callable to invoke
+      template<typename Fn>
+      void post( Fn&& fn );
+
+      /// \brief Schedules \p fn to be invoked on a worker, returning a future
+      ///        for its result
+      ///
+      /// Exceptions thrown by \p fn are stored in the future. The future's
+      /// shared state is allocated; use \c post where that matters.
+      ///
+      /// \param fn the nullary callable to invoke
+      /// \return the future result of \p fn
+      template<typename Fn>
+      std::future<invoke_result<Fn>> submit( Fn&& fn );
+
+      //----------------------------------------------------------------------
+      // Execution
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Runs one pending task on the calling thread, if any
+      ///
+      /// A task that waits for work it has forked can call this in a loop to
+      /// help with that work, rather than blocking a worker.
+      ///
+      /// \return \c true if a task was run
+      bool run_pending_task();
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns the number of workers
+      ///
+      /// \return the number of workers
+      std::size_t size() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      struct worker
+      {
+        work_stealing_deque<detail::task_node*> deque;
+        std::uint32_t                           random; ///< xorshift state
+        std::thread                             thread;
+      };
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::vector<std::unique_ptr<worker>> m_workers;
+      mpmc_queue<detail::task_node*>       m_queue; ///< work from outside
+      eventcount                           m_idle;  ///< parks idle workers
+      std::atomic<bool>                    m_stopping;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Queues \p node, and wakes a sleeping worker
+      void schedule( detail::task_node* node );
+
+      /// \brief Finds work for \p self, or for a thread outside the pool if
+      ///        \p self is \c nullptr
+      detail::task_node* find_task( worker* self ) noexcept;
+
+      /// \brief The main loop of the worker at \p index
+      void work( std::size_t index );
+
+      static void execute( detail::task_node* node );
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/work_stealing_pool.inl"
+
+#endif /* BIT_CONCURRENCY_EXECUTORS_WORK_STEALING_POOL_HPP */
@@ -0,0 +1,132 @@
+/**
+ * \file adaptive_mutex.hpp
+ *
+ * \brief This header contains an implementation of a mutex that spins
+ *        adaptively before parking in the kernel
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_LOCKS_ADAPTIVE_MUTEX_HPP
+#define BIT_CONCURRENCY_LOCKS_ADAPTIVE_MUTEX_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "semaphore.hpp"
+
+#include "../utilities/backoff.hpp"
+#include "../utilities/spin_budget.hpp"
+
+#include <atomic>
+#include <chrono>
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A mutex that spins briefly before parking the thread in the
+    ///        kernel
+    ///
+    /// The uncontended path is a single compare-and-swap. A contended
+    /// locker first spins for up to a per-instance spin_budget, which adapts
+    /// to the recent acquisition history, and then registers itself as a
+    /// waiter and parks on a semaphore. Ownership is handed directly to a
+    /// parked waiter on unlock.
+    ///
+    /// This makes the same type suitable both for dedicated cores, where
+    /// spinning wins, and for oversubscribed hosts, where it does not.
+    //////////////////////////////////////////////////////////////////////////
+    class adaptive_mutex
+    {
+      template<typename Rep, typename Period>
+      using duration = std::chrono::duration<Rep,Period>;
+
+      template<typename Clock, typename Duration>
+      using time_point = std::chrono::time_point<Clock,Duration>;
+
+      //----------------------------------------------------------------------
+      // Constructors / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an unlocked adaptive_mutex
+      adaptive_mutex();
+
+      // Deleted copy constructor
+      adaptive_mutex( const adaptive_mutex& ) = delete;
+
+      // Deleted move constructor
+      adaptive_mutex( adaptive_mutex&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      adaptive_mutex& operator=( const adaptive_mutex& ) = delete;
+
+      // Deleted move assignment
+      adaptive_mutex& operator=( adaptive_mutex&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Locking
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Locks the adaptive_mutex, parking if spinning fails
+      void lock();
+
+      /// \brief Tries to lock the adaptive_mutex without waiting
+      ///
+      /// \return \c true if the lock is acquired
+      bool try_lock() noexcept;
+
+      /// \brief Attempts to lock the adaptive_mutex for \p duration
+      ///
+      /// \param duration the timeout duration
+      /// \return \c true if the lock is acquired
+      template<typename Rep, typename Period>
+      bool try_lock_for( const duration<Rep,Period>& duration );
+
+      /// \brief Attempts to lock the adaptive_mutex until \p time
+      ///
+      /// \param time the time point to stop trying
+      /// \return \c true if the lock is acquired
+      template<typename Clock, typename Duration>
+      bool try_lock_until( const time_point<Clock,Duration>& time );
+
+      /// \brief Unlocks the adaptive_mutex, handing it to a parked waiter
+      ///        if there is one
+      void unlock();
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      /// The owner plus the number of parked (or parking) waiters
+      std::atomic<int> m_count;
+      spin_budget      m_spin;
+      semaphore        m_semaphore;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Spins for up to the current spin budget
+      ///
+      /// \return \c true if the lock was acquired while spinning
+      bool spin_acquire() noexcept;
+
+      /// \brief Withdraws a timed-out waiter
+      ///
+      /// \return \c true if the lock was handed over regardless
+      bool cancel_wait();
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/adaptive_mutex.inl"
+
+#endif /* BIT_CONCURRENCY_LOCKS_ADAPTIVE_MUTEX_HPP */
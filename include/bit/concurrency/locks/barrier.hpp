@@ -0,0 +1,169 @@
+/**
+ * \file barrier.hpp
+ *
+ * \brief This header contains a reusable phase barrier built on a combining
+ *        tree
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_LOCKS_BARRIER_HPP
+#define BIT_CONCURRENCY_LOCKS_BARRIER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "eventcount.hpp"
+
+#include "../utilities/cache_aligned.hpp"
+#include "../utilities/per_thread.hpp"
+#include "../utilities/spin_budget.hpp"
+
+#include <atomic>  // std::atomic
+#include <cstddef> // std::ptrdiff_t, std::size_t
+#include <cstdint> // std::uint32_t
+#include <memory>  // std::unique_ptr
+#include <utility> // std::move
+
+namespace bit {
+  namespace concurrency {
+    namespace detail {
+
+      /// \brief The default barrier completion, which does nothing
+      struct barrier_noop_completion
+      {
+        void operator()() noexcept{}
+      };
+
+    } // namespace detail
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A reusable barrier that releases a fixed number of threads
+    ///        once they have all arrived, phase after phase
+    ///
+    /// This mirrors C++20's std::barrier, without arrive_and_drop. When the
+    /// last thread of a phase arrives, it runs the completion function and
+    /// then releases the phase; the completion happens-before any thread
+    /// returns from waiting on that phase.
+    ///
+    /// Arrivals are combined in a tree rather than on one counter. Each
+    /// leaf admits up to \c fan_in arrivals per phase, and the thread that
+    /// fills a node carries a single arrival on to its parent, so no cache
+    /// line sees more than \c fan_in writers per phase. Threads start at a
+    /// leaf picked from a per-thread index, and move to the next leaf only
+    /// if theirs is already full.
+    ///
+    /// Waiters spin for a spin_budget on the phase number, which the
+    /// releasing thread advances; this is sense reversal generalized to a
+    /// counter, so no per-thread sense is kept. Waiters that outlast the
+    /// budget park on an eventcount.
+    ///
+    /// \tparam CompletionFunction a nothrow nullary callable run once per
+    ///         phase
+    //////////////////////////////////////////////////////////////////////////
+    template<typename CompletionFunction = detail::barrier_noop_completion>
+    class barrier
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types / Static Members
+      //----------------------------------------------------------------------
+    public:
+
+      /// The phase that an arrival took part in
+      using arrival_token = std::uint32_t;
+
+      /// The most arrivals combined at a node of the tree
+      static constexpr std::ptrdiff_t fan_in = 4;
+
+      //----------------------------------------------------------------------
+      // Constructors / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a barrier for \p expected threads per phase
+      ///
+      /// \param expected the number of arrivals per phase. Must be positive
+      /// \param completion the function to run at the end of each phase
+      explicit barrier( std::ptrdiff_t expected,
+                        CompletionFunction completion = CompletionFunction() );
+
+      // Deleted copy constructor
+      barrier( const barrier& ) = delete;
+
+      // Deleted move constructor
+      barrier( barrier&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      barrier& operator=( const barrier& ) = delete;
+
+      // Deleted move assignment
+      barrier& operator=( barrier&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Arrival
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Arrives at the current phase without waiting
+      ///
+      /// \return a token for waiting on the phase
+      arrival_token arrive();
+
+      /// \brief Blocks until the phase of \p token has completed
+      ///
+      /// \param token the token returned from arrive
+      void wait( arrival_token token ) const;
+
+      /// \brief Arrives at the current phase, and blocks until it completes
+      void arrive_and_wait();
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      struct node
+      {
+        std::atomic<std::ptrdiff_t> remaining; ///< arrivals still expected
+        std::ptrdiff_t              capacity;
+        std::ptrdiff_t              parent;    ///< -1 at the root
+      };
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::unique_ptr<padded<node>[]> m_nodes; ///< leaves first, the root last
+      std::ptrdiff_t                  m_node_count;
+      std::ptrdiff_t                  m_leaves;
+
+      // The padding keeps the phase, which waiters poll, off of the lines
+      // read by every arrival
+      padded<CompletionFunction> m_completion;
+
+      std::atomic<arrival_token> m_phase;
+      mutable spin_budget        m_spin;
+      mutable eventcount         m_event;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Runs the completion, resets the tree, and releases the phase
+      ///        of \p token
+      void complete( arrival_token token );
+
+      /// \brief Returns the leaf that the calling thread starts at
+      std::ptrdiff_t this_thread_leaf() const noexcept;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/barrier.inl"
+
+#endif /* BIT_CONCURRENCY_LOCKS_BARRIER_HPP */
@@ -0,0 +1,113 @@
+/**
+ * \file clh_lock.hpp
+ *
+ * \brief This header contains an implementation of the Craig, Landin and
+ *        Hagersten (CLH) queue lock
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_LOCKS_CLH_LOCK_HPP
+#define BIT_CONCURRENCY_LOCKS_CLH_LOCK_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/lock_node_cache.hpp"
+
+#include "../utilities/backoff.hpp"
+#include "../utilities/cache_aligned.hpp"
+
+#include <atomic>
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A FIFO-fair queue lock where each waiter spins on the node of
+    ///        its predecessor
+    ///
+    /// Unlike the mcs_lock, the hand-over is a single store with no
+    /// compare-and-swap, since a waiter never needs to link itself to its
+    /// predecessor. On release, the owner keeps its predecessor's node for
+    /// reuse, so nodes migrate between threads.
+    ///
+    /// \c unlock must be called from the thread that acquired the lock.
+    ///
+    /// This satisfies BasicLockable, but not Lockable: the lock state lives
+    /// in the tail node, which a caller that has not enqueued does not own
+    /// and so cannot safely inspect. Use mcs_lock where \c try_lock is
+    /// needed.
+    //////////////////////////////////////////////////////////////////////////
+    class clh_lock
+    {
+      //------------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an unlocked clh_lock
+      clh_lock();
+
+      // Deleted copy constructor
+      clh_lock( const clh_lock& ) = delete;
+
+      // Deleted move constructor
+      clh_lock( clh_lock&& ) = delete;
+
+      //------------------------------------------------------------------------
+
+      /// \brief Destroys this clh_lock
+      ///
+      /// \pre the lock is not held
+      ~clh_lock();
+
+      //------------------------------------------------------------------------
+
+      // Deleted copy assignment
+      clh_lock& operator=( const clh_lock& ) = delete;
+
+      // Deleted move assignment
+      clh_lock& operator=( clh_lock&& ) = delete;
+
+      //------------------------------------------------------------------------
+      // Locking
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Locks the clh_lock, waiting for all earlier lockers
+      void lock();
+
+      /// \brief Unlocks the clh_lock, handing it to the next waiter
+      void unlock() noexcept;
+
+      //------------------------------------------------------------------------
+      // Private Member Types
+      //------------------------------------------------------------------------
+    private:
+
+      struct node : detail::cache_line_allocated
+      {
+        std::atomic<bool> locked; ///< whether the successor must keep waiting
+        node*             cache_next;
+      };
+
+      using node_cache = detail::lock_node_cache<node>;
+
+      //------------------------------------------------------------------------
+      // Private Members
+      //------------------------------------------------------------------------
+    private:
+
+      std::atomic<node*> m_tail;        ///< the last node in the queue
+      node*              m_owner;       ///< the owner's node; owner access only
+      node*              m_predecessor; ///< the node the owner waited on
+
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/clh_lock.inl"
+
+#endif /* BIT_CONCURRENCY_LOCKS_CLH_LOCK_HPP */
@@ -0,0 +1,123 @@
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_ADAPTIVE_MUTEX_INL
+#define BIT_CONCURRENCY_LOCKS_DETAIL_ADAPTIVE_MUTEX_INL
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::adaptive_mutex::adaptive_mutex()
+  : m_count(0),
+    m_spin(),
+    m_semaphore(0)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+inline void bit::concurrency::adaptive_mutex::lock()
+{
+  if( try_lock() || spin_acquire() ) {
+    return;
+  }
+
+  // Register as a waiter; if the owner released in the meantime, this
+  // acquires the lock outright
+  if( m_count.fetch_add(1, std::memory_order_acquire) > 0 ) {
+    m_semaphore.wait();
+  }
+}
+
+inline bool bit::concurrency::adaptive_mutex::try_lock()
+  noexcept
+{
+  auto expected = 0;
+
+  return m_count.compare_exchange_strong( expected, 1,
+                                          std::memory_order_acquire,
+                                          std::memory_order_relaxed );
+}
+
+template<typename Rep, typename Period>
+inline bool bit::concurrency::adaptive_mutex
+  ::try_lock_for( const duration<Rep,Period>& duration )
+{
+  if( try_lock() || spin_acquire() ) {
+    return true;
+  }
+
+  if( m_count.fetch_add(1, std::memory_order_acquire) == 0 ) {
+    return true;
+  }
+
+  return m_semaphore.try_wait_for( duration ) || cancel_wait();
+}
+
+template<typename Clock, typename Duration>
+inline bool bit::concurrency::adaptive_mutex
+  ::try_lock_until( const time_point<Clock,Duration>& time )
+{
+  auto diff = (time - Clock::now());
+
+  // If 'time' was not in the past, try waiting.
+  if( diff.count() > 0 ) {
+    return try_lock_for( diff );
+  }
+
+  // Otherwise try locking now
+  return try_lock();
+}
+
+inline void bit::concurrency::adaptive_mutex::unlock()
+{
+  // Any count above this owner is a waiter that is, or will be, parked on
+  // the semaphore; wake exactly one of them to take over ownership
+  if( m_count.fetch_sub(1, std::memory_order_release) > 1 ) {
+    m_semaphore.signal();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+inline bool bit::concurrency::adaptive_mutex::spin_acquire()
+  noexcept
+{
+  const auto budget = m_spin.spins();
+
+  for( auto spins = 0; spins < budget; ++spins ) {
+    cpu_relax();
+
+    if( m_count.load(std::memory_order_relaxed) == 0 && try_lock() ) {
+      m_spin.acquired(spins);
+      return true;
+    }
+  }
+
+  m_spin.parked();
+  return false;
+}
+
+inline bool bit::concurrency::adaptive_mutex::cancel_wait()
+{
+  auto count = m_count.load(std::memory_order_relaxed);
+
+  while( true ) {
+    // If this is the only remaining count, the owner has already released
+    // and signaled the semaphore on this waiter's behalf
+    if( count == 1 ) {
+      m_semaphore.wait();
+      return true;
+    }
+
+    if( m_count.compare_exchange_weak( count, count - 1,
+                                       std::memory_order_relaxed ) ) {
+      return false;
+    }
+  }
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_ADAPTIVE_MUTEX_INL */
@@ -0,0 +1,180 @@
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_BARRIER_INL
+#define BIT_CONCURRENCY_LOCKS_DETAIL_BARRIER_INL
+
+#include "../../utilities/backoff.hpp"
+
+#include <cassert> // assert
+
+//----------------------------------------------------------------------------
+// Static Members
+//----------------------------------------------------------------------------
+
+template<typename CompletionFunction>
+constexpr std::ptrdiff_t bit::concurrency::barrier<CompletionFunction>::fan_in;
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+template<typename CompletionFunction>
+inline bit::concurrency::barrier<CompletionFunction>
+  ::barrier( std::ptrdiff_t expected, CompletionFunction completion )
+  : m_nodes(),
+    m_node_count(0),
+    m_leaves((expected + fan_in - 1) / fan_in),
+    m_completion(std::move(completion)),
+    m_phase(0),
+    m_spin(),
+    m_event()
+{
+  assert( expected > 0 && "barrier requires at least one thread" );
+
+  // Count the nodes of every level, from the leaves up to the root
+  auto level = m_leaves;
+  m_node_count = level;
+  while( level > 1 ) {
+    level = (level + fan_in - 1) / fan_in;
+    m_node_count += level;
+  }
+
+  m_nodes.reset( new padded<node>[static_cast<std::size_t>(m_node_count)] );
+
+  // Spread the arrivals evenly over the leaves
+  for( auto i = std::ptrdiff_t(0); i < m_leaves; ++i ) {
+    m_nodes[i]->capacity = expected / m_leaves + (i < expected % m_leaves ? 1 : 0);
+  }
+
+  // Each inner node expects one arrival per child
+  auto first = std::ptrdiff_t(0);
+  level = m_leaves;
+  while( level > 1 ) {
+    const auto parents = (level + fan_in - 1) / fan_in;
+    const auto parent_first = first + level;
+
+    for( auto i = std::ptrdiff_t(0); i < parents; ++i ) {
+      m_nodes[parent_first + i]->capacity = 0;
+    }
+    for( auto i = std::ptrdiff_t(0); i < level; ++i ) {
+      m_nodes[first + i]->parent = parent_first + i / fan_in;
+      ++m_nodes[parent_first + i / fan_in]->capacity;
+    }
+
+    first = parent_first;
+    level = parents;
+  }
+  m_nodes[m_node_count - 1]->parent = -1;
+
+  for( auto i = std::ptrdiff_t(0); i < m_node_count; ++i ) {
+    m_nodes[i]->remaining.store(m_nodes[i]->capacity, std::memory_order_relaxed);
+  }
+}
+
+//----------------------------------------------------------------------------
+// Arrival
+//----------------------------------------------------------------------------
+
+template<typename CompletionFunction>
+inline typename bit::concurrency::barrier<CompletionFunction>::arrival_token
+  bit::concurrency::barrier<CompletionFunction>::arrive()
+{
+  // The phase cannot advance before this thread arrives
+  const auto token = m_phase.load(std::memory_order_acquire);
+
+  // Take a place at a leaf, moving on from any leaf that is already full
+  auto index = this_thread_leaf();
+  auto remaining = std::ptrdiff_t();
+
+  while( true ) {
+    remaining = m_nodes[index]->remaining.load(std::memory_order_relaxed);
+
+    while( remaining > 0 &&
+           !m_nodes[index]->remaining.compare_exchange_weak( remaining, remaining - 1,
+                                                            std::memory_order_acq_rel,
+                                                            std::memory_order_relaxed ) ) {
+      // retry with the reloaded count
+    }
+    if( remaining > 0 ) break;
+
+    index = (index + 1 == m_leaves) ? 0 : index + 1;
+  }
+
+  // The thread that fills a node carries the arrival up the tree
+  if( remaining != 1 ) return token;
+
+  index = m_nodes[index]->parent;
+  while( index >= 0 ) {
+    if( m_nodes[index]->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1 ) {
+      return token;
+    }
+    index = m_nodes[index]->parent;
+  }
+
+  complete( token );
+  return token;
+}
+
+template<typename CompletionFunction>
+inline void bit::concurrency::barrier<CompletionFunction>
+  ::wait( arrival_token token )
+  const
+{
+  const auto budget = m_spin.spins();
+
+  for( auto spins = 0; spins < budget; ++spins ) {
+    if( m_phase.load(std::memory_order_acquire) != token ) {
+      m_spin.acquired( spins );
+      return;
+    }
+    cpu_relax();
+  }
+  m_spin.parked();
+
+  while( m_phase.load(std::memory_order_acquire) == token ) {
+    const auto key = m_event.prepare_wait();
+
+    if( m_phase.load(std::memory_order_acquire) != token ) {
+      m_event.cancel_wait();
+      return;
+    }
+    m_event.commit_wait( key );
+  }
+}
+
+template<typename CompletionFunction>
+inline void bit::concurrency::barrier<CompletionFunction>::arrive_and_wait()
+{
+  wait( arrive() );
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename CompletionFunction>
+inline void bit::concurrency::barrier<CompletionFunction>
+  ::complete( arrival_token token )
+{
+  (*m_completion)();
+
+  // Every arrival of this phase has been counted, so nothing reads the tree
+  // until the phase advances
+  for( auto i = std::ptrdiff_t(0); i < m_node_count; ++i ) {
+    m_nodes[i]->remaining.store(m_nodes[i]->capacity, std::memory_order_relaxed);
+  }
+
+  m_phase.store(token + 1, std::memory_order_release);
+  m_event.notify_all();
+}
+
+template<typename CompletionFunction>
+inline std::ptrdiff_t bit::concurrency::barrier<CompletionFunction>::this_thread_leaf()
+  const noexcept
+{
+  // Threads are numbered in the order they first stripe, and each run of
+  // 'fan_in' consecutive threads shares a leaf, which it exactly fills
+  const auto index = this_thread_index();
+
+  return static_cast<std::ptrdiff_t>((index / fan_in) % static_cast<std::size_t>(m_leaves));
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_BARRIER_INL */
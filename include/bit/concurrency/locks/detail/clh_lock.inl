@@ -0,0 +1,61 @@
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_CLH_LOCK_INL
+#define BIT_CONCURRENCY_LOCKS_DETAIL_CLH_LOCK_INL
+
+//----------------------------------------------------------------------------
+// Constructor / Destructor
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::clh_lock::clh_lock()
+  : m_tail(node_cache::acquire()),
+    m_owner(nullptr),
+    m_predecessor(nullptr)
+{
+  // The initial tail is a released sentinel for the first locker to wait on
+  m_tail.load(std::memory_order_relaxed)->locked.store(false, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::clh_lock::~clh_lock()
+{
+  // The tail node of an unlocked queue belongs to the lock, not a thread
+  delete m_tail.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+inline void bit::concurrency::clh_lock::lock()
+{
+  auto* self = node_cache::acquire();
+
+  self->locked.store(true, std::memory_order_relaxed);
+
+  auto* predecessor = m_tail.exchange(self, std::memory_order_acq_rel);
+
+  auto backoff = exponential_backoff<>{};
+  while( predecessor->locked.load(std::memory_order_acquire) ) {
+    backoff();
+  }
+
+  m_owner       = self;
+  m_predecessor = predecessor;
+}
+
+inline void bit::concurrency::clh_lock::unlock()
+  noexcept
+{
+  // Both members must be read before the hand-over, since the successor
+  // overwrites them once it owns the lock
+  auto* self        = m_owner;
+  auto* predecessor = m_predecessor;
+
+  self->locked.store(false, std::memory_order_release);
+
+  // Nobody references the predecessor's node anymore, so it is recycled in
+  // place of the node still being watched by the successor
+  node_cache::release(predecessor);
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_CLH_LOCK_INL */
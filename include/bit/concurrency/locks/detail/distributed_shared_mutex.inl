@@ -0,0 +1,124 @@
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_DISTRIBUTED_SHARED_MUTEX_INL
+#define BIT_CONCURRENCY_LOCKS_DETAIL_DISTRIBUTED_SHARED_MUTEX_INL
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+template<std::size_t Slots>
+inline bit::concurrency::basic_distributed_shared_mutex<Slots>
+  ::basic_distributed_shared_mutex()
+  : m_readers(),
+    m_writer(false),
+    m_writer_mutex()
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+template<std::size_t Slots>
+inline void bit::concurrency::basic_distributed_shared_mutex<Slots>::lock()
+{
+  m_writer_mutex.lock();
+
+  // Turn away new readers, then drain the ones already inside. This store
+  // and the reader's increment-then-check are both sequentially consistent,
+  // so either the reader sees the flag, or the writer sees the reader.
+  m_writer.store(true, std::memory_order_seq_cst);
+  wait_for_readers();
+}
+
+template<std::size_t Slots>
+inline bool bit::concurrency::basic_distributed_shared_mutex<Slots>::try_lock()
+{
+  if( !m_writer_mutex.try_lock() ) {
+    return false;
+  }
+
+  m_writer.store(true, std::memory_order_seq_cst);
+  if( has_readers() ) {
+    m_writer.store(false, std::memory_order_release);
+    m_writer_mutex.unlock();
+    return false;
+  }
+  return true;
+}
+
+template<std::size_t Slots>
+inline void bit::concurrency::basic_distributed_shared_mutex<Slots>::unlock()
+{
+  m_writer.store(false, std::memory_order_release);
+  m_writer_mutex.unlock();
+}
+
+//----------------------------------------------------------------------------
+// Shared Locking
+//----------------------------------------------------------------------------
+
+template<std::size_t Slots>
+inline void bit::concurrency::basic_distributed_shared_mutex<Slots>::lock_shared()
+{
+  while( !try_lock_shared() ) {
+    // Wait for the writer to finish by passing through its mutex
+    m_writer_mutex.lock();
+    m_writer_mutex.unlock();
+  }
+}
+
+template<std::size_t Slots>
+inline bool bit::concurrency::basic_distributed_shared_mutex<Slots>::try_lock_shared()
+  noexcept
+{
+  // Threads are handed slots round-robin, so up to 'Slots' concurrent
+  // readers each get a cache line of their own
+  auto& readers = m_readers.local();
+
+  readers.fetch_add(1, std::memory_order_seq_cst);
+  if( !m_writer.load(std::memory_order_seq_cst) ) {
+    return true;
+  }
+
+  // A writer is entering or inside; back out so that it may drain
+  readers.fetch_sub(1, std::memory_order_release);
+  return false;
+}
+
+template<std::size_t Slots>
+inline void bit::concurrency::basic_distributed_shared_mutex<Slots>::unlock_shared()
+  noexcept
+{
+  m_readers.local().fetch_sub(1, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<std::size_t Slots>
+inline void bit::concurrency::basic_distributed_shared_mutex<Slots>::wait_for_readers()
+  noexcept
+{
+  for( auto& readers : m_readers ) {
+    auto backoff = exponential_backoff<>{};
+    while( readers.load(std::memory_order_seq_cst) != 0 ) {
+      backoff();
+    }
+  }
+}
+
+template<std::size_t Slots>
+inline bool bit::concurrency::basic_distributed_shared_mutex<Slots>::has_readers()
+  const noexcept
+{
+  for( const auto& readers : m_readers ) {
+    if( readers.load(std::memory_order_seq_cst) != 0 ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_DISTRIBUTED_SHARED_MUTEX_INL */
@@ -0,0 +1,239 @@
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_EVENTCOUNT_INL
+#define BIT_CONCURRENCY_LOCKS_DETAIL_EVENTCOUNT_INL
+
+#include <mutex> // std::lock_guard
+
+namespace bit {
+  namespace concurrency {
+    namespace detail {
+
+      // The layout of an eventcount's state
+      constexpr std::uint64_t eventcount_waiter_mask = 0x00000000ffffffff;
+      constexpr std::uint64_t eventcount_epoch_unit  = 0x0000000100000000;
+      constexpr int           eventcount_epoch_shift = 32;
+
+      /// \brief Gets the calling thread's parking node
+      ///
+      /// A thread waits on at most one eventcount at a time, so one node per
+      /// thread serves all of them.
+      inline eventcount_waiter& this_thread_eventcount_waiter()
+      {
+        thread_local eventcount_waiter waiter;
+
+        return waiter;
+      }
+
+    } // namespace detail
+  } // namespace concurrency
+} // namespace bit
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::eventcount::eventcount()
+  : m_state(0),
+    m_lock(),
+    m_head(nullptr),
+    m_tail(nullptr)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Waiting
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::eventcount::key_type
+  bit::concurrency::eventcount::prepare_wait()
+  noexcept
+{
+  const auto state = m_state.fetch_add(1, std::memory_order_seq_cst);
+
+  // The announcement must be visible before the caller re-checks its
+  // condition; this pairs with the fence in the notifiers.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  return static_cast<key_type>(state >> detail::eventcount_epoch_shift);
+}
+
+inline void bit::concurrency::eventcount::commit_wait( key_type key )
+{
+  auto& waiter = detail::this_thread_eventcount_waiter();
+
+  if( !enqueue( waiter, key ) ) {
+    return;
+  }
+
+  // The notifier that dequeued this thread has already withdrawn it
+  waiter.parker.wait();
+}
+
+template<typename Clock, typename Duration>
+inline bool bit::concurrency::eventcount
+  ::commit_wait_until( key_type key,
+                       const std::chrono::time_point<Clock,Duration>& time )
+{
+  auto& waiter = detail::this_thread_eventcount_waiter();
+
+  if( !enqueue( waiter, key ) ) {
+    return true;
+  }
+
+  const auto remaining = time - Clock::now();
+
+  if( remaining.count() > 0 ? waiter.parker.try_wait_for( remaining )
+                            : waiter.parker.try_wait() ) {
+    return true;
+  }
+
+  if( remove( waiter ) ) {
+    return false;
+  }
+
+  // A notify dequeued this thread before it could withdraw, and has signaled
+  // or is about to signal its parker; the signal must be consumed before the
+  // node is reused
+  waiter.parker.wait();
+  return true;
+}
+
+inline void bit::concurrency::eventcount::cancel_wait()
+{
+  m_state.fetch_sub(1, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+// Notifying
+//----------------------------------------------------------------------------
+
+inline void bit::concurrency::eventcount::notify_one()
+{
+  // The caller's change to the condition must be visible before the waiter
+  // count is read; this pairs with the fence in 'prepare_wait'.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if( (m_state.load(std::memory_order_relaxed) & detail::eventcount_waiter_mask) == 0 ) {
+    return;
+  }
+
+  auto* waiter = release( 1 );
+
+  if( waiter != nullptr ) {
+    waiter->parker.signal();
+  }
+}
+
+inline void bit::concurrency::eventcount::notify_all()
+{
+  // Pairs with the fence in 'prepare_wait'
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if( (m_state.load(std::memory_order_relaxed) & detail::eventcount_waiter_mask) == 0 ) {
+    return;
+  }
+
+  auto* waiter = release( detail::eventcount_waiter_mask );
+
+  while( waiter != nullptr ) {
+    // Once signaled, the waiter may return and reuse its node
+    auto* next = waiter->next;
+    waiter->parker.signal();
+    waiter = next;
+  }
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+inline bool bit::concurrency::eventcount
+  ::enqueue( detail::eventcount_waiter& waiter, key_type key )
+{
+  std::lock_guard<spin_lock> lock{ m_lock };
+
+  const auto state = m_state.load(std::memory_order_relaxed);
+
+  // A notify has happened since prepare_wait, so the condition may already
+  // hold; withdraw rather than sleep.
+  if( static_cast<key_type>(state >> detail::eventcount_epoch_shift) != key ) {
+    m_state.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  waiter.next = nullptr;
+  if( m_tail == nullptr ) {
+    m_head = &waiter;
+  } else {
+    m_tail->next = &waiter;
+  }
+  m_tail = &waiter;
+
+  return true;
+}
+
+inline bool bit::concurrency::eventcount
+  ::remove( detail::eventcount_waiter& waiter )
+{
+  std::lock_guard<spin_lock> lock{ m_lock };
+
+  auto* previous = static_cast<detail::eventcount_waiter*>(nullptr);
+  auto* current  = m_head;
+
+  while( current != nullptr && current != &waiter ) {
+    previous = current;
+    current  = current->next;
+  }
+
+  if( current == nullptr ) {
+    return false;
+  }
+
+  if( previous == nullptr ) {
+    m_head = waiter.next;
+  } else {
+    previous->next = waiter.next;
+  }
+  if( m_tail == &waiter ) {
+    m_tail = previous;
+  }
+
+  m_state.fetch_sub(1, std::memory_order_relaxed);
+  return true;
+}
+
+inline bit::concurrency::detail::eventcount_waiter*
+  bit::concurrency::eventcount::release( std::uint32_t count )
+{
+  std::lock_guard<spin_lock> lock{ m_lock };
+
+  // Waiters that have prepared but not yet committed see the new epoch, and
+  // withdraw instead of sleeping
+  m_state.fetch_add(detail::eventcount_epoch_unit, std::memory_order_relaxed);
+
+  auto* head = m_head;
+  auto* last = static_cast<detail::eventcount_waiter*>(nullptr);
+  auto released = std::uint32_t(0);
+
+  while( m_head != nullptr && released < count ) {
+    last   = m_head;
+    m_head = m_head->next;
+    ++released;
+  }
+
+  if( last == nullptr ) {
+    return nullptr;
+  }
+  last->next = nullptr;
+
+  if( m_head == nullptr ) {
+    m_tail = nullptr;
+  }
+
+  // Dequeued waiters are no longer counted
+  m_state.fetch_sub(released, std::memory_order_relaxed);
+
+  return head;
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_EVENTCOUNT_INL */
@@ -0,0 +1,186 @@
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_FLAT_COMBINING_LOCK_INL
+#define BIT_CONCURRENCY_LOCKS_DETAIL_FLAT_COMBINING_LOCK_INL
+
+#include <exception> // std::current_exception, std::rethrow_exception
+
+//----------------------------------------------------------------------------
+// Static Members
+//----------------------------------------------------------------------------
+
+template<typename T, std::size_t Slots>
+constexpr typename bit::concurrency::flat_combining_lock<T,Slots>::size_type
+  bit::concurrency::flat_combining_lock<T,Slots>::max_passes;
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+template<typename T, std::size_t Slots>
+inline bit::concurrency::flat_combining_lock<T,Slots>::flat_combining_lock()
+  : m_locked(false),
+    m_active(0),
+    m_value(),
+    m_slots()
+{
+
+}
+
+template<typename T, std::size_t Slots>
+inline bit::concurrency::flat_combining_lock<T,Slots>
+  ::flat_combining_lock( const T& value )
+  : m_locked(false),
+    m_active(0),
+    m_value(value),
+    m_slots()
+{
+
+}
+
+template<typename T, std::size_t Slots>
+inline bit::concurrency::flat_combining_lock<T,Slots>
+  ::flat_combining_lock( T&& value )
+  : m_locked(false),
+    m_active(0),
+    m_value(std::move(value)),
+    m_slots()
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Operations
+//----------------------------------------------------------------------------
+
+template<typename T, std::size_t Slots>
+template<typename Fn>
+inline typename bit::concurrency::flat_combining_lock<T,Slots>::template apply_result<Fn>
+  bit::concurrency::flat_combining_lock<T,Slots>::apply( Fn&& fn )
+{
+  using result_type = apply_result<Fn>;
+  using fn_type     = typename std::remove_reference<Fn>::type;
+
+  static_assert( !std::is_reference<result_type>::value,
+                 "flat_combining_lock cannot return a reference into the "
+                 "guarded value" );
+
+  typed_operation<fn_type,result_type> op( fn );
+
+  publish( op );
+
+  if( op.error ) {
+    std::rethrow_exception( op.error );
+  }
+  return op.result.get();
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename T, std::size_t Slots>
+template<typename Fn, typename R>
+inline bit::concurrency::flat_combining_lock<T,Slots>::typed_operation<Fn,R>
+  ::typed_operation( Fn& f )
+  noexcept
+  : operation{ &typed_operation::execute_typed, nullptr },
+    fn(f),
+    result()
+{
+
+}
+
+template<typename T, std::size_t Slots>
+template<typename Fn, typename R>
+inline void bit::concurrency::flat_combining_lock<T,Slots>::typed_operation<Fn,R>
+  ::execute_typed( operation* op, T& value )
+  noexcept
+{
+  auto* self = static_cast<typed_operation*>(op);
+
+  try {
+    self->result.invoke( self->fn, value );
+  } catch( ... ) {
+    self->error = std::current_exception();
+  }
+}
+
+//----------------------------------------------------------------------------
+
+template<typename T, std::size_t Slots>
+inline void bit::concurrency::flat_combining_lock<T,Slots>
+  ::publish( operation& op )
+{
+  const auto index = this_thread_index() % Slots;
+  auto& s = m_slots[index];
+  auto backoff = spin_then_yield_backoff<>();
+
+  // Threads beyond 'Slots' share, and take turns; combining while waiting
+  // keeps the thread that holds the slot from waiting on this one
+  while( s.claimed.load(std::memory_order_relaxed) ||
+         s.claimed.exchange(true, std::memory_order_acquire) ) {
+    if( !try_combine() ) backoff();
+  }
+
+  auto active = m_active->load(std::memory_order_relaxed);
+  while( active <= index &&
+         !m_active->compare_exchange_weak( active, index + 1,
+                                           std::memory_order_relaxed,
+                                           std::memory_order_relaxed ) ) {
+    // 'active' is reloaded with the current count
+  }
+
+  // A combiner that reads a stale count misses this slot, but this thread
+  // then combines for itself
+  s.pending.store(&op, std::memory_order_release);
+
+  // Yielding matters once the combiner has been preempted, which is the
+  // only time a wait is long
+  backoff = spin_then_yield_backoff<>();
+  while( s.pending.load(std::memory_order_acquire) != nullptr ) {
+    if( !try_combine() ) backoff();
+  }
+
+  s.claimed.store(false, std::memory_order_release);
+}
+
+template<typename T, std::size_t Slots>
+inline bool bit::concurrency::flat_combining_lock<T,Slots>::try_combine()
+  noexcept
+{
+  if( m_locked.load(std::memory_order_relaxed) ||
+      m_locked.exchange(true, std::memory_order_acquire) ) {
+    return false;
+  }
+
+  combine();
+
+  m_locked.store(false, std::memory_order_release);
+  return true;
+}
+
+template<typename T, std::size_t Slots>
+inline void bit::concurrency::flat_combining_lock<T,Slots>::combine()
+  noexcept
+{
+  for( auto pass = size_type(0); pass != max_passes; ++pass ) {
+    const auto active = m_active->load(std::memory_order_relaxed);
+    auto found = false;
+
+    for( auto i = size_type(0); i != active; ++i ) {
+      auto& s = m_slots[i];
+      auto* op = s.pending.load(std::memory_order_acquire);
+
+      if( op == nullptr ) continue;
+
+      op->execute( op, *m_value );
+      found = true;
+
+      // Releases the result to the publisher, which may then destroy 'op'
+      s.pending.store(nullptr, std::memory_order_release);
+    }
+
+    if( !found ) break;
+  }
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_FLAT_COMBINING_LOCK_INL */
@@ -0,0 +1,241 @@
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_INSTRUMENTED_MUTEX_INL
+#define BIT_CONCURRENCY_LOCKS_DETAIL_INSTRUMENTED_MUTEX_INL
+
+//============================================================================
+// lock_statistics
+//============================================================================
+
+inline double bit::concurrency::lock_statistics::contended_fraction()
+  const noexcept
+{
+  if( acquisitions == 0 ) return 0.0;
+
+  return static_cast<double>(contended) / static_cast<double>(acquisitions);
+}
+
+//============================================================================
+// detail
+//============================================================================
+
+inline std::size_t bit::concurrency::detail::lock_statistics_bucket( std::uint64_t ns )
+  noexcept
+{
+  // The bucket is the bit width of 'ns'
+  auto bucket = std::size_t(0);
+
+#if defined(__GNUC__) || defined(__clang__)
+  bucket = (ns == 0) ? 0 : static_cast<std::size_t>(64 - __builtin_clzll(ns));
+#else
+  while( ns != 0 ) {
+    ns >>= 1;
+    ++bucket;
+  }
+#endif
+
+  return (bucket < lock_statistics::bucket_count) ? bucket
+                                                  : lock_statistics::bucket_count - 1;
+}
+
+//============================================================================
+// instrumented_mutex
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+template<typename Mutex, std::size_t Slots>
+inline bit::concurrency::instrumented_mutex<Mutex,Slots>::instrumented_mutex()
+  : m_mutex(),
+    m_acquired_at(),
+    m_slots()
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+template<typename Mutex, std::size_t Slots>
+inline void bit::concurrency::instrumented_mutex<Mutex,Slots>::lock()
+{
+  auto wait = clock::duration::zero();
+  const auto contended = acquire( m_mutex, wait, detail::is_try_lockable<Mutex>{} );
+
+  m_acquired_at = clock::now();
+  record_acquisition( wait, contended );
+}
+
+template<typename Mutex, std::size_t Slots>
+inline bool bit::concurrency::instrumented_mutex<Mutex,Slots>::try_lock()
+{
+  if( !m_mutex.try_lock() ) return false;
+
+  m_acquired_at = clock::now();
+  record_acquisition( clock::duration::zero(), false );
+  return true;
+}
+
+template<typename Mutex, std::size_t Slots>
+inline void bit::concurrency::instrumented_mutex<Mutex,Slots>::unlock()
+{
+  const auto held = clock::now() - m_acquired_at;
+
+  m_mutex.unlock();
+
+  const auto ns = static_cast<std::uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(held).count()
+  );
+  auto& s = m_slots.local();
+
+  s.total_hold_ns.fetch_add(ns, std::memory_order_relaxed);
+  s.hold_histogram[detail::lock_statistics_bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+// Shared Locking
+//----------------------------------------------------------------------------
+
+template<typename Mutex, std::size_t Slots>
+inline void bit::concurrency::instrumented_mutex<Mutex,Slots>::lock_shared()
+{
+  if( m_mutex.try_lock_shared() ) {
+    record_acquisition( clock::duration::zero(), false );
+    return;
+  }
+
+  const auto start = clock::now();
+  m_mutex.lock_shared();
+  record_acquisition( clock::now() - start, true );
+}
+
+template<typename Mutex, std::size_t Slots>
+inline bool bit::concurrency::instrumented_mutex<Mutex,Slots>::try_lock_shared()
+{
+  if( !m_mutex.try_lock_shared() ) return false;
+
+  record_acquisition( clock::duration::zero(), false );
+  return true;
+}
+
+template<typename Mutex, std::size_t Slots>
+inline void bit::concurrency::instrumented_mutex<Mutex,Slots>::unlock_shared()
+{
+  m_mutex.unlock_shared();
+}
+
+//----------------------------------------------------------------------------
+// Statistics
+//----------------------------------------------------------------------------
+
+template<typename Mutex, std::size_t Slots>
+inline bit::concurrency::lock_statistics
+  bit::concurrency::instrumented_mutex<Mutex,Slots>::snapshot()
+  const noexcept
+{
+  auto result = lock_statistics();
+
+  result.acquisitions  = 0;
+  result.contended     = 0;
+  result.total_wait_ns = 0;
+  result.total_hold_ns = 0;
+  result.wait_histogram.fill(0);
+  result.hold_histogram.fill(0);
+
+  for( const auto& s : m_slots ) {
+    result.acquisitions  += s.acquisitions.load(std::memory_order_relaxed);
+    result.contended     += s.contended.load(std::memory_order_relaxed);
+    result.total_wait_ns += s.total_wait_ns.load(std::memory_order_relaxed);
+    result.total_hold_ns += s.total_hold_ns.load(std::memory_order_relaxed);
+
+    for( auto i = std::size_t(0); i < lock_statistics::bucket_count; ++i ) {
+      result.wait_histogram[i] += s.wait_histogram[i].load(std::memory_order_relaxed);
+      result.hold_histogram[i] += s.hold_histogram[i].load(std::memory_order_relaxed);
+    }
+  }
+  return result;
+}
+
+template<typename Mutex, std::size_t Slots>
+inline void bit::concurrency::instrumented_mutex<Mutex,Slots>::reset()
+  noexcept
+{
+  for( auto& s : m_slots ) {
+    s.acquisitions.store(0, std::memory_order_relaxed);
+    s.contended.store(0, std::memory_order_relaxed);
+    s.total_wait_ns.store(0, std::memory_order_relaxed);
+    s.total_hold_ns.store(0, std::memory_order_relaxed);
+
+    for( auto i = std::size_t(0); i < lock_statistics::bucket_count; ++i ) {
+      s.wait_histogram[i].store(0, std::memory_order_relaxed);
+      s.hold_histogram[i].store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+template<typename Mutex, std::size_t Slots>
+inline typename bit::concurrency::instrumented_mutex<Mutex,Slots>::mutex_type&
+  bit::concurrency::instrumented_mutex<Mutex,Slots>::native()
+  noexcept
+{
+  return m_mutex;
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename Mutex, std::size_t Slots>
+template<typename M>
+inline bool bit::concurrency::instrumented_mutex<Mutex,Slots>
+  ::acquire( M& mutex, clock::duration& wait, std::true_type )
+{
+  if( mutex.try_lock() ) {
+    return false;
+  }
+
+  const auto start = clock::now();
+  mutex.lock();
+  wait = clock::now() - start;
+  return true;
+}
+
+template<typename Mutex, std::size_t Slots>
+template<typename M>
+inline bool bit::concurrency::instrumented_mutex<Mutex,Slots>
+  ::acquire( M& mutex, clock::duration& wait, std::false_type )
+{
+  const auto start = clock::now();
+  mutex.lock();
+  wait = clock::now() - start;
+
+  // Without try_lock, no acquisition is known to have waited
+  return false;
+}
+
+template<typename Mutex, std::size_t Slots>
+inline void bit::concurrency::instrumented_mutex<Mutex,Slots>
+  ::record_acquisition( clock::duration wait, bool contended )
+  noexcept
+{
+  auto& s = m_slots.local();
+
+  s.acquisitions.fetch_add(1, std::memory_order_relaxed);
+  if( contended ) {
+    s.contended.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  const auto ns = static_cast<std::uint64_t>(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(wait).count()
+  );
+
+  s.total_wait_ns.fetch_add(ns, std::memory_order_relaxed);
+  s.wait_histogram[detail::lock_statistics_bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_INSTRUMENTED_MUTEX_INL */
@@ -0,0 +1,62 @@
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_LATCH_INL
+#define BIT_CONCURRENCY_LOCKS_DETAIL_LATCH_INL
+
+#include <cassert> // assert
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::latch::latch( std::ptrdiff_t expected )
+  : m_count(expected),
+    m_event()
+{
+  assert( expected >= 0 && "latch count must not be negative" );
+}
+
+//----------------------------------------------------------------------------
+// Counting
+//----------------------------------------------------------------------------
+
+inline void bit::concurrency::latch::count_down( std::ptrdiff_t n )
+{
+  const auto previous = m_count.fetch_sub(n, std::memory_order_acq_rel);
+
+  assert( previous >= n && "latch counted down past zero" );
+
+  if( previous == n ) {
+    m_event.notify_all();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Waiting
+//----------------------------------------------------------------------------
+
+inline bool bit::concurrency::latch::try_wait()
+  const noexcept
+{
+  return m_count.load(std::memory_order_acquire) == 0;
+}
+
+inline void bit::concurrency::latch::wait()
+  const
+{
+  while( !try_wait() ) {
+    const auto key = m_event.prepare_wait();
+
+    if( try_wait() ) {
+      m_event.cancel_wait();
+      return;
+    }
+    m_event.commit_wait( key );
+  }
+}
+
+inline void bit::concurrency::latch::arrive_and_wait( std::ptrdiff_t n )
+{
+  count_down( n );
+  wait();
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_LATCH_INL */
@@ -0,0 +1,146 @@
+/**
+ * \file lock_node_cache.hpp
+ *
+ * \brief This header contains the thread-local cache of queue nodes used by
+ *        the queue-based locks
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_LOCK_NODE_CACHE_HPP
+#define BIT_CONCURRENCY_LOCKS_DETAIL_LOCK_NODE_CACHE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+namespace bit {
+  namespace concurrency {
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A per-thread free-list of queue nodes
+      ///
+      /// Queue locks need one node per acquisition, but the Lockable concept
+      /// gives nowhere to put it. Nodes are instead drawn from, and returned
+      /// to, a cache owned by the calling thread, so that steady-state
+      /// locking never allocates.
+      ///
+      /// Nodes are allocated with 'new', and freed with 'delete' when their
+      /// thread exits, so a node type that derives from
+      /// cache_line_allocated is given lines of its own.
+      ///
+      /// \tparam Node the node type. Must be default-constructible and
+      ///              contain a \c Node* member named \c cache_next
+      ////////////////////////////////////////////////////////////////////////
+      template<typename Node>
+      class lock_node_cache
+      {
+        //--------------------------------------------------------------------
+        // Static Member Functions
+        //--------------------------------------------------------------------
+      public:
+
+        /// \brief Takes a node from the calling thread's cache, allocating
+        ///        one if the cache is empty
+        ///
+        /// \return the node
+        static Node* acquire();
+
+        /// \brief Returns \p node to the calling thread's cache
+        ///
+        /// \param node the node to return
+        static void release( Node* node ) noexcept;
+
+        //--------------------------------------------------------------------
+        // Private Member Types
+        //--------------------------------------------------------------------
+      private:
+
+        struct free_list
+        {
+          free_list() noexcept;
+          ~free_list();
+
+          Node* head;
+        };
+
+        //--------------------------------------------------------------------
+        // Private Static Member Functions
+        //--------------------------------------------------------------------
+      private:
+
+        static free_list& local() noexcept;
+      };
+
+    } // namespace detail
+  } // namespace concurrency
+} // namespace bit
+
+//============================================================================
+// Inline Definitions : lock_node_cache
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Static Member Functions
+//----------------------------------------------------------------------------
+
+template<typename Node>
+inline Node* bit::concurrency::detail::lock_node_cache<Node>::acquire()
+{
+  auto& cache = local();
+  auto* node  = cache.head;
+
+  if( node == nullptr ) {
+    return new Node();
+  }
+  cache.head = node->cache_next;
+  return node;
+}
+
+template<typename Node>
+inline void bit::concurrency::detail::lock_node_cache<Node>::release( Node* node )
+  noexcept
+{
+  auto& cache = local();
+
+  node->cache_next = cache.head;
+  cache.head = node;
+}
+
+//----------------------------------------------------------------------------
+// Private Member Types
+//----------------------------------------------------------------------------
+
+template<typename Node>
+inline bit::concurrency::detail::lock_node_cache<Node>::free_list::free_list()
+  noexcept
+  : head(nullptr)
+{
+
+}
+
+template<typename Node>
+inline bit::concurrency::detail::lock_node_cache<Node>::free_list::~free_list()
+{
+  while( head != nullptr ) {
+    auto* next = head->cache_next;
+    delete head;
+    head = next;
+  }
+}
+
+//----------------------------------------------------------------------------
+// Private Static Member Functions
+//----------------------------------------------------------------------------
+
+template<typename Node>
+inline typename bit::concurrency::detail::lock_node_cache<Node>::free_list&
+  bit::concurrency::detail::lock_node_cache<Node>::local()
+  noexcept
+{
+  thread_local free_list cache;
+
+  return cache;
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_LOCK_NODE_CACHE_HPP */
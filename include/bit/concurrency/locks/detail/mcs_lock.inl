@@ -0,0 +1,88 @@
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_MCS_LOCK_INL
+#define BIT_CONCURRENCY_LOCKS_DETAIL_MCS_LOCK_INL
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+inline constexpr bit::concurrency::mcs_lock::mcs_lock()
+  noexcept
+  : m_tail(nullptr),
+    m_owner(nullptr)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+inline void bit::concurrency::mcs_lock::lock()
+{
+  auto* self = node_cache::acquire();
+
+  self->next.store(nullptr, std::memory_order_relaxed);
+  self->locked.store(true, std::memory_order_relaxed);
+
+  auto* predecessor = m_tail.exchange(self, std::memory_order_acq_rel);
+
+  if( predecessor != nullptr ) {
+    predecessor->next.store(self, std::memory_order_release);
+
+    auto backoff = exponential_backoff<>{};
+    while( self->locked.load(std::memory_order_acquire) ) {
+      backoff();
+    }
+  }
+
+  m_owner = self;
+}
+
+inline bool bit::concurrency::mcs_lock::try_lock()
+{
+  auto* self = node_cache::acquire();
+
+  self->next.store(nullptr, std::memory_order_relaxed);
+  self->locked.store(true, std::memory_order_relaxed);
+
+  auto* expected = static_cast<node*>(nullptr);
+  if( m_tail.compare_exchange_strong( expected, self,
+                                      std::memory_order_acq_rel,
+                                      std::memory_order_relaxed ) ) {
+    m_owner = self;
+    return true;
+  }
+
+  node_cache::release(self);
+  return false;
+}
+
+inline void bit::concurrency::mcs_lock::unlock()
+  noexcept
+{
+  // 'm_owner' must be read before the hand-over, since the successor
+  // overwrites it once it owns the lock
+  auto* self      = m_owner;
+  auto* successor = self->next.load(std::memory_order_acquire);
+
+  if( successor == nullptr ) {
+    // No known successor; if this is still the tail, the queue is empty
+    auto* expected = self;
+    if( m_tail.compare_exchange_strong( expected, nullptr,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed ) ) {
+      node_cache::release(self);
+      return;
+    }
+
+    // A successor has swapped the tail, but not yet linked itself
+    while( (successor = self->next.load(std::memory_order_acquire)) == nullptr ) {
+      cpu_relax();
+    }
+  }
+
+  successor->locked.store(false, std::memory_order_release);
+  node_cache::release(self);
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_MCS_LOCK_INL */
@@ -40,7 +40,11 @@ inline bool
 inline bit::concurrency::semaphore::native_handle_type
   bit::concurrency::semaphore::native_handle()
 {
+#if defined(BIT_CONCURRENCY_SEMAPHORE_FUTEX)
+  return &m_count;
+#else
   return m_semaphore;
+#endif
 }
 
 #endif /* BIT_CONCURRENCY_LOCKS_DETAIL_SEMAPHORE_INL */
@@ -0,0 +1,127 @@
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_SEQLOCK_INL
+#define BIT_CONCURRENCY_LOCKS_DETAIL_SEQLOCK_INL
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+template<typename T, typename Mutex>
+inline bit::concurrency::seqlock<T,Mutex>::seqlock()
+  : seqlock( T() )
+{
+
+}
+
+template<typename T, typename Mutex>
+inline bit::concurrency::seqlock<T,Mutex>::seqlock( const T& value )
+  : m_sequence(0),
+    m_mutex()
+{
+  word_type words[word_count] = {};
+  std::memcpy( words, &value, sizeof(T) );
+
+  for( auto i = std::size_t(0); i < word_count; ++i ) {
+    m_data[i].store(words[i], std::memory_order_relaxed);
+  }
+}
+
+//----------------------------------------------------------------------------
+// Reading
+//----------------------------------------------------------------------------
+
+template<typename T, typename Mutex>
+inline T bit::concurrency::seqlock<T,Mutex>::load()
+  const noexcept
+{
+  word_type words[word_count];
+
+  while( true ) {
+    const auto before = m_sequence.load(std::memory_order_acquire);
+
+    // A writer is active; the copy would be discarded anyway
+    if( before & 1u ) {
+      cpu_relax();
+      continue;
+    }
+
+    for( auto i = std::size_t(0); i < word_count; ++i ) {
+      words[i] = m_data[i].load(std::memory_order_relaxed);
+    }
+
+    // Orders the data loads before the re-check of the sequence
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if( m_sequence.load(std::memory_order_relaxed) == before ) {
+      break;
+    }
+  }
+
+  auto result = T();
+  std::memcpy( &result, words, sizeof(T) );
+  return result;
+}
+
+//----------------------------------------------------------------------------
+// Writing
+//----------------------------------------------------------------------------
+
+template<typename T, typename Mutex>
+inline void bit::concurrency::seqlock<T,Mutex>::store( const T& value )
+{
+  std::lock_guard<Mutex> guard(m_mutex);
+
+  publish( value );
+}
+
+template<typename T, typename Mutex>
+template<typename Fn>
+inline void bit::concurrency::seqlock<T,Mutex>::write( Fn&& fn )
+{
+  std::lock_guard<Mutex> guard(m_mutex);
+
+  auto value = read_locked();
+  std::forward<Fn>(fn)( value );
+  publish( value );
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename T, typename Mutex>
+inline void bit::concurrency::seqlock<T,Mutex>::publish( const T& value )
+  noexcept
+{
+  word_type words[word_count] = {};
+  std::memcpy( words, &value, sizeof(T) );
+
+  const auto sequence = m_sequence.load(std::memory_order_relaxed);
+
+  m_sequence.store(sequence + 1, std::memory_order_relaxed);
+
+  // Orders the odd sequence before any of the data stores
+  std::atomic_thread_fence(std::memory_order_release);
+
+  for( auto i = std::size_t(0); i < word_count; ++i ) {
+    m_data[i].store(words[i], std::memory_order_relaxed);
+  }
+
+  m_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+template<typename T, typename Mutex>
+inline T bit::concurrency::seqlock<T,Mutex>::read_locked()
+  const noexcept
+{
+  word_type words[word_count];
+
+  for( auto i = std::size_t(0); i < word_count; ++i ) {
+    words[i] = m_data[i].load(std::memory_order_relaxed);
+  }
+
+  auto result = T();
+  std::memcpy( &result, words, sizeof(T) );
+  return result;
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_SEQLOCK_INL */
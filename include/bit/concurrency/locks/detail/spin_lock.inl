@@ -0,0 +1,54 @@
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_SPIN_LOCK_INL
+#define BIT_CONCURRENCY_LOCKS_DETAIL_SPIN_LOCK_INL
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+template<typename Backoff>
+inline constexpr bit::concurrency::basic_spin_lock<Backoff>::basic_spin_lock()
+  noexcept
+  : m_lock(false)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+template<typename Backoff>
+inline void bit::concurrency::basic_spin_lock<Backoff>::lock()
+  noexcept
+{
+  // Fast-path: uncontended acquisition costs a single exchange
+  if( !m_lock.exchange(true, std::memory_order_acquire) ) {
+    return;
+  }
+
+  auto backoff = Backoff{};
+  do {
+    // Spin on a load so that waiters only share the cache line, rather than
+    // contending for exclusive ownership of it on every iteration
+    do {
+      backoff();
+    } while( m_lock.load(std::memory_order_relaxed) );
+  } while( m_lock.exchange(true, std::memory_order_acquire) );
+}
+
+template<typename Backoff>
+inline bool bit::concurrency::basic_spin_lock<Backoff>::try_lock()
+  noexcept
+{
+  return !m_lock.load(std::memory_order_relaxed) &&
+         !m_lock.exchange(true, std::memory_order_acquire);
+}
+
+template<typename Backoff>
+inline void bit::concurrency::basic_spin_lock<Backoff>::unlock()
+  noexcept
+{
+  m_lock.store(false, std::memory_order_release);
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_SPIN_LOCK_INL */
@@ -17,9 +17,10 @@ inline bit::concurrency::spinning_semaphore::spinning_semaphore()
 
 inline bit::concurrency::spinning_semaphore::spinning_semaphore( int count )
   : m_count(count),
+    m_spin(),
     m_semaphore(0)
 {
-  assert( count > 0 );
+  assert( count >= 0 );
 }
 
 //-----------------------------------------------------------------------------
@@ -83,19 +84,18 @@ inline void bit::concurrency::spinning_semaphore::signal( int count )
 
 inline void bit::concurrency::spinning_semaphore::partial_spin_wait()
 {
-  auto old  = int();
-  auto spin = int(10000);
+  const auto budget = m_spin.spins();
 
-  while( spin-- ) {
-    old = m_count.load(std::memory_order_relaxed);
-    if( (old > 0) && m_count.compare_exchange_strong(old, old-1, std::memory_order_acquire) ) {
+  for( auto spins = 0; spins < budget; ++spins ) {
+    if( try_wait() ) {
+      m_spin.acquired(spins);
       return;
     }
-    // Prevent the compiler from collapsing the loop.
-    std::atomic_signal_fence(std::memory_order_acquire);
+    cpu_relax();
   }
+  m_spin.parked();
 
-  old = m_count.fetch_sub(1, std::memory_order_acquire);
+  auto old = m_count.fetch_sub(1, std::memory_order_acquire);
 
   if(old <= 0) {
     m_semaphore.wait();
@@ -106,11 +106,10 @@ template<typename Rep, typename Period>
 inline bool bit::concurrency::spinning_semaphore
   ::try_partial_spin_wait( const duration<Rep,Period>& duration )
 {
-  auto start = std::chrono::steady_clock::now();
-  auto old   = int();
-  auto spin  = int(10000);
+  const auto start  = std::chrono::steady_clock::now();
+  const auto budget = m_spin.spins();
 
-  while( spin-- ) {
+  for( auto spins = 0; spins < budget; ++spins ) {
 
     // If we wait the entire duration and aren't signaled, return false
     auto diff = (std::chrono::steady_clock::now() - start);
@@ -119,24 +118,44 @@ inline bool bit::concurrency::spinning_semaphore
     }
 
     // If we get signaled, return true
-    old = m_count.load(std::memory_order_relaxed);
-    if( (old > 0) && m_count.compare_exchange_strong(old, old-1, std::memory_order_acquire) ) {
+    if( try_wait() ) {
+      m_spin.acquired(spins);
       return true;
     }
-    // Prevent the compiler from collapsing the loop.
-    std::atomic_signal_fence(std::memory_order_acquire);
+    cpu_relax();
   }
+  m_spin.parked();
 
-  old = m_count.fetch_sub(1, std::memory_order_acquire);
+  auto old = m_count.fetch_sub(1, std::memory_order_acquire);
 
-  if(old <= 0) {
-    auto remaining = (std::chrono::steady_clock::now() - start) - duration;
-    if( remaining.count() > 0 ) {
-      return m_semaphore.try_wait_for( remaining );
+  if(old > 0) {
+    return true;
+  }
+
+  auto elapsed = (std::chrono::steady_clock::now() - start);
+  if( elapsed < duration && m_semaphore.try_wait_for( duration - elapsed ) ) {
+    return true;
+  }
+  return cancel_wait();
+}
+
+inline bool bit::concurrency::spinning_semaphore::cancel_wait()
+{
+  auto count = m_count.load(std::memory_order_relaxed);
+
+  while( true ) {
+    // A non-negative count means 'signal' has already released the
+    // semaphore on behalf of every waiter, including this one
+    if( count >= 0 ) {
+      m_semaphore.wait();
+      return true;
+    }
+
+    if( m_count.compare_exchange_weak( count, count + 1,
+                                       std::memory_order_relaxed ) ) {
+      return false;
     }
-    return m_semaphore.try_wait();
   }
-  return true;
 }
 
 #endif /* BIT_CONCURRENCY_LOCKS_DETAIL_SPINNING_SEMAPHORE_INL */
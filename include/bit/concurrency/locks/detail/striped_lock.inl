@@ -0,0 +1,144 @@
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_STRIPED_LOCK_INL
+#define BIT_CONCURRENCY_LOCKS_DETAIL_STRIPED_LOCK_INL
+
+#include <algorithm> // std::sort, std::unique
+#include <cstdint>   // std::uint64_t
+
+//----------------------------------------------------------------------------
+// Stripes
+//----------------------------------------------------------------------------
+
+template<typename Mutex, std::size_t Stripes>
+template<typename Key>
+inline typename bit::concurrency::striped_lock<Mutex,Stripes>::size_type
+  bit::concurrency::striped_lock<Mutex,Stripes>::index_for( const Key& key )
+  const noexcept
+{
+  return index_for_hash( std::hash<Key>{}(key) );
+}
+
+template<typename Mutex, std::size_t Stripes>
+inline typename bit::concurrency::striped_lock<Mutex,Stripes>::size_type
+  bit::concurrency::striped_lock<Mutex,Stripes>::index_for_hash( std::size_t hash )
+  const noexcept
+{
+  // Fibonacci hashing moves the entropy of the low bits into the high
+  // ones, which are then kept
+  const auto mixed = static_cast<std::uint64_t>(hash) * 0x9e3779b97f4a7c15ull;
+
+  return static_cast<size_type>((mixed >> 32) % Stripes);
+}
+
+template<typename Mutex, std::size_t Stripes>
+template<typename Key>
+inline typename bit::concurrency::striped_lock<Mutex,Stripes>::mutex_type&
+  bit::concurrency::striped_lock<Mutex,Stripes>::stripe_for( const Key& key )
+  noexcept
+{
+  return m_stripes[index_for(key)].get();
+}
+
+template<typename Mutex, std::size_t Stripes>
+inline typename bit::concurrency::striped_lock<Mutex,Stripes>::mutex_type&
+  bit::concurrency::striped_lock<Mutex,Stripes>::stripe( size_type index )
+  noexcept
+{
+  return m_stripes[index].get();
+}
+
+template<typename Mutex, std::size_t Stripes>
+inline constexpr typename bit::concurrency::striped_lock<Mutex,Stripes>::size_type
+  bit::concurrency::striped_lock<Mutex,Stripes>::size()
+  noexcept
+{
+  return Stripes;
+}
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+template<typename Mutex, std::size_t Stripes>
+template<typename...Keys>
+inline void bit::concurrency::striped_lock<Mutex,Stripes>
+  ::lock_many( const Keys&...keys )
+{
+  auto indices = index_array<sizeof...(Keys)>{{ index_for(keys)... }};
+  const auto count = sort_unique( indices );
+
+  auto locked = size_type(0);
+  try {
+    for( ; locked < count; ++locked ) {
+      m_stripes[indices[locked]]->lock();
+    }
+  } catch( ... ) {
+    while( locked != 0 ) {
+      m_stripes[indices[--locked]]->unlock();
+    }
+    throw;
+  }
+}
+
+template<typename Mutex, std::size_t Stripes>
+template<typename...Keys>
+inline void bit::concurrency::striped_lock<Mutex,Stripes>
+  ::unlock_many( const Keys&...keys )
+{
+  auto indices = index_array<sizeof...(Keys)>{{ index_for(keys)... }};
+  auto count = sort_unique( indices );
+
+  while( count != 0 ) {
+    m_stripes[indices[--count]]->unlock();
+  }
+}
+
+template<typename Mutex, std::size_t Stripes>
+template<typename...Keys>
+inline void bit::concurrency::striped_lock<Mutex,Stripes>
+  ::lock_shared_many( const Keys&...keys )
+{
+  auto indices = index_array<sizeof...(Keys)>{{ index_for(keys)... }};
+  const auto count = sort_unique( indices );
+
+  auto locked = size_type(0);
+  try {
+    for( ; locked < count; ++locked ) {
+      m_stripes[indices[locked]]->lock_shared();
+    }
+  } catch( ... ) {
+    while( locked != 0 ) {
+      m_stripes[indices[--locked]]->unlock_shared();
+    }
+    throw;
+  }
+}
+
+template<typename Mutex, std::size_t Stripes>
+template<typename...Keys>
+inline void bit::concurrency::striped_lock<Mutex,Stripes>
+  ::unlock_shared_many( const Keys&...keys )
+{
+  auto indices = index_array<sizeof...(Keys)>{{ index_for(keys)... }};
+  auto count = sort_unique( indices );
+
+  while( count != 0 ) {
+    m_stripes[indices[--count]]->unlock_shared();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename Mutex, std::size_t Stripes>
+template<std::size_t N>
+inline typename bit::concurrency::striped_lock<Mutex,Stripes>::size_type
+  bit::concurrency::striped_lock<Mutex,Stripes>::sort_unique( index_array<N>& indices )
+  noexcept
+{
+  std::sort( indices.begin(), indices.end() );
+
+  return static_cast<size_type>(std::unique( indices.begin(), indices.end() ) - indices.begin());
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_STRIPED_LOCK_INL */
@@ -0,0 +1,63 @@
+#ifndef BIT_CONCURRENCY_LOCKS_DETAIL_TICKET_LOCK_INL
+#define BIT_CONCURRENCY_LOCKS_DETAIL_TICKET_LOCK_INL
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+inline constexpr bit::concurrency::ticket_lock::ticket_lock()
+  noexcept
+  : m_next(0),
+    m_serving(0)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+inline void bit::concurrency::ticket_lock::lock()
+  noexcept
+{
+  const auto ticket = m_next->fetch_add(1, std::memory_order_relaxed);
+
+  auto backoff = spin_then_yield_backoff<>{};
+  while( true ) {
+    const auto serving = m_serving->load(std::memory_order_acquire);
+    if( serving == ticket ) {
+      return;
+    }
+
+    // Back off proportionally to the number of waiters ahead of this one.
+    // Unsigned arithmetic keeps this correct across wrap-around.
+    auto distance = static_cast<std::uint32_t>(ticket - serving);
+    while( distance-- ) {
+      cpu_relax();
+    }
+    backoff();
+  }
+}
+
+inline bool bit::concurrency::ticket_lock::try_lock()
+  noexcept
+{
+  auto serving = m_serving->load(std::memory_order_acquire);
+
+  // The lock is free only if the next ticket to be handed out is the one
+  // being served; claiming that ticket acquires the lock.
+  return m_next->compare_exchange_strong( serving, serving + 1u,
+                                          std::memory_order_acquire,
+                                          std::memory_order_relaxed );
+}
+
+inline void bit::concurrency::ticket_lock::unlock()
+  noexcept
+{
+  // Only the owner writes 'm_serving', so a load/store pair suffices
+  const auto serving = m_serving->load(std::memory_order_relaxed);
+
+  m_serving->store(serving + 1u, std::memory_order_release);
+}
+
+#endif /* BIT_CONCURRENCY_LOCKS_DETAIL_TICKET_LOCK_INL */
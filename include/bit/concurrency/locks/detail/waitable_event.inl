@@ -1,12 +1,28 @@
 #ifndef BIT_CONCURRENCY_LOCKS_DETAIL_WAITABLE_EVENT_INL
 #define BIT_CONCURRENCY_LOCKS_DETAIL_WAITABLE_EVENT_INL
 
+namespace bit {
+  namespace concurrency {
+    namespace detail {
+
+      // The layout of a manual-reset waitable_event's state
+      constexpr std::int64_t event_signaled_bit    = 0x0000000000000001;
+      constexpr std::int64_t event_generation_unit = 0x0000000000000002;
+      constexpr std::int64_t event_generation_mask = 0x7ffffffffffffffe;
+
+    } // namespace detail
+  } // namespace concurrency
+} // namespace bit
+
 //----------------------------------------------------------------------------
 // Constructor / Assignment
 //----------------------------------------------------------------------------
 
-inline bit::concurrency::waitable_event::waitable_event()
-  : m_signal(false)
+inline bit::concurrency::waitable_event::waitable_event( reset_mode mode )
+  : m_state(0),
+    m_mode(mode),
+    m_semaphore(0),
+    m_event()
 {
 
 }
@@ -17,44 +33,84 @@ inline bit::concurrency::waitable_event::waitable_event()
 
 inline void bit::concurrency::waitable_event::wait()
 {
-  std::unique_lock<std::mutex> lock(m_mutex);
+  auto generation = std::int64_t();
+
+  if( register_wait( generation ) ) {
+    return;
+  }
+
+  if( m_mode == reset_mode::automatic ) {
+    m_semaphore.wait();
+    return;
+  }
+
+  while( !is_released( generation ) ) {
+    const auto key = m_event.prepare_wait();
+
+    if( is_released( generation ) ) {
+      m_event.cancel_wait();
+      return;
+    }
+    m_event.commit_wait( key );
+  }
+}
+
+inline bool bit::concurrency::waitable_event::try_wait()
+  noexcept
+{
+  if( m_mode == reset_mode::manual ) {
+    return (m_state.load(std::memory_order_acquire) & detail::event_signaled_bit) != 0;
+  }
 
-  m_cv.wait(lock, [this](){ return m_signal; });
-  m_signal = false;
+  auto expected = std::int64_t(1);
+  return m_state.compare_exchange_strong( expected, 0,
+                                          std::memory_order_acquire,
+                                          std::memory_order_relaxed );
 }
 
 template<typename Rep, typename Period>
 inline bool bit::concurrency::waitable_event
-  ::wait_for( const std::chrono::duration<Rep,Period>& duration )
+  ::wait_for( const duration<Rep,Period>& duration )
 {
-  auto success = false;
-  { // critical section
-    std::unique_lock<std::mutex> lock(m_mutex);
+  auto generation = std::int64_t();
+
+  if( register_wait( generation ) ) {
+    return true;
+  }
 
-    success = m_cv.wait_for(lock, duration, [this](){ return m_signal; });
+  const auto deadline = std::chrono::steady_clock::now() + duration;
 
-    // Only locks if successful (thread-safe access)
-    if( success ) m_signal = false;
+  if( m_mode == reset_mode::automatic ) {
+    return m_semaphore.try_wait_until( deadline ) || cancel_wait();
   }
 
-  return success;
+  while( !is_released( generation ) ) {
+    const auto key = m_event.prepare_wait();
+
+    if( is_released( generation ) ) {
+      m_event.cancel_wait();
+      return true;
+    }
+    if( !m_event.commit_wait_until( key, deadline ) ) {
+      return is_released( generation );
+    }
+  }
+  return true;
 }
 
 template<typename Clock, typename Duration>
 inline bool bit::concurrency::waitable_event
-  ::wait_until( const std::chrono::time_point<Clock,Duration>& time_point )
+  ::wait_until( const time_point<Clock,Duration>& time_point )
 {
-  auto success = false;
-  { // critical section
-    std::unique_lock<std::mutex> lock(m_mutex);
+  auto diff = (time_point - Clock::now());
 
-    success = m_cv.wait_until(lock, time_point, [this](){ return m_signal; });
-
-    // Only locks if successful (thread-safe access)
-    if( success ) m_signal = false;
+  // If 'time_point' was not in the past, try waiting.
+  if( diff.count() > 0 ) {
+    return wait_for( diff );
   }
 
-  return success;
+  // Otherwise try waiting now
+  return try_wait();
 }
 
 //----------------------------------------------------------------------------
@@ -63,12 +119,106 @@ inline bool bit::concurrency::waitable_event
 
 inline void bit::concurrency::waitable_event::signal()
 {
-  { // critical section
-    std::unique_lock<std::mutex> lock(m_mutex);
+  auto state = m_state.load(std::memory_order_relaxed);
+
+  if( m_mode == reset_mode::manual ) {
+    auto next = std::int64_t();
+
+    // Signaling an already-signaled event has no effect, since it has no
+    // waiters to release
+    do {
+      if( state & detail::event_signaled_bit ) {
+        return;
+      }
+      next = ((state + detail::event_generation_unit) & detail::event_generation_mask)
+           | detail::event_signaled_bit;
+    } while( !m_state.compare_exchange_weak( state, next,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed ) );
+
+    m_event.notify_all();
+    return;
+  }
+
+  // Automatic: either release one waiter, or become signaled if there are
+  // none. Signaling an already-signaled event has no effect.
+  do {
+    if( state == 1 ) {
+      return;
+    }
+  } while( !m_state.compare_exchange_weak( state, state + 1,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed ) );
+
+  if( state < 0 ) {
+    m_semaphore.signal();
+  }
+}
+
+inline void bit::concurrency::waitable_event::reset()
+  noexcept
+{
+  if( m_mode == reset_mode::manual ) {
+    m_state.fetch_and(~detail::event_signaled_bit, std::memory_order_relaxed);
+    return;
+  }
+
+  auto expected = std::int64_t(1);
+  m_state.compare_exchange_strong( expected, 0, std::memory_order_relaxed );
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::waitable_event::reset_mode
+  bit::concurrency::waitable_event::mode()
+  const noexcept
+{
+  return m_mode;
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+inline bool bit::concurrency::waitable_event::register_wait( std::int64_t& generation )
+  noexcept
+{
+  if( m_mode == reset_mode::automatic ) {
+    // Consumes the signal if there is one, otherwise registers as a waiter
+    return m_state.fetch_sub(1, std::memory_order_acquire) > 0;
+  }
+
+  const auto state = m_state.load(std::memory_order_acquire);
+
+  generation = state & detail::event_generation_mask;
+  return (state & detail::event_signaled_bit) != 0;
+}
+
+inline bool bit::concurrency::waitable_event::is_released( std::int64_t generation )
+  const noexcept
+{
+  const auto state = m_state.load(std::memory_order_acquire);
 
-    m_signal = true;
+  return (state & detail::event_generation_mask) != generation;
+}
+
+inline bool bit::concurrency::waitable_event::cancel_wait()
+{
+  auto state = m_state.load(std::memory_order_relaxed);
+
+  while( true ) {
+    // A signal since registering has already posted this waiter's permit
+    if( state >= 0 ) {
+      m_semaphore.wait();
+      return true;
+    }
+
+    if( m_state.compare_exchange_weak( state, state + 1, std::memory_order_relaxed ) ) {
+      return false;
+    }
   }
-  m_cv.notify_all();
 }
 
 #endif /* BIT_CONCURRENCY_LOCKS_DETAIL_WAITABLE_EVENT_INL */
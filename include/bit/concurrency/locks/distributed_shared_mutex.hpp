@@ -0,0 +1,144 @@
+/**
+ * \file distributed_shared_mutex.hpp
+ *
+ * \brief This header contains a reader-biased shared mutex that distributes
+ *        its reader count across cache lines
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_LOCKS_DISTRIBUTED_SHARED_MUTEX_HPP
+#define BIT_CONCURRENCY_LOCKS_DISTRIBUTED_SHARED_MUTEX_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "adaptive_mutex.hpp"
+
+#include "../utilities/backoff.hpp"
+#include "../utilities/per_thread.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A reader-biased shared mutex with a distributed reader
+    ///        indicator
+    ///
+    /// Rather than counting readers in a single word, each reader increments
+    /// one of \p Slots counters, each on its own cache line, chosen by the
+    /// calling thread. Readers on different slots never write to the same
+    /// cache line, so read-side throughput scales with the number of reader
+    /// cores.
+    ///
+    /// A writer raises a flag that turns new readers away, and then drains
+    /// every slot before entering; turned-away readers park on the writer's
+    /// mutex until it is released. Writers are therefore expensive, roughly
+    /// proportional to \p Slots, which makes this lock suitable for data
+    /// that is read far more often than it is written. Prefer shared_mutex
+    /// otherwise.
+    ///
+    /// Shared ownership must be released by the thread that acquired it.
+    ///
+    /// \tparam Slots the number of reader slots
+    //////////////////////////////////////////////////////////////////////////
+    template<std::size_t Slots>
+    class basic_distributed_shared_mutex
+    {
+      static_assert( Slots > 0, "There must be at least one reader slot" );
+
+      //----------------------------------------------------------------------
+      // Constructors / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an unlocked basic_distributed_shared_mutex
+      basic_distributed_shared_mutex();
+
+      // Deleted copy constructor
+      basic_distributed_shared_mutex( const basic_distributed_shared_mutex& ) = delete;
+
+      // Deleted move constructor
+      basic_distributed_shared_mutex( basic_distributed_shared_mutex&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      basic_distributed_shared_mutex& operator=( const basic_distributed_shared_mutex& ) = delete;
+
+      // Deleted move assignment
+      basic_distributed_shared_mutex& operator=( basic_distributed_shared_mutex&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Locking
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Locks this mutex exclusively, waiting for all readers to
+      ///        leave
+      void lock();
+
+      /// \brief Tries to lock this mutex exclusively without waiting
+      ///
+      /// \return \c true if the lock is acquired
+      bool try_lock();
+
+      /// \brief Unlocks this mutex from exclusive ownership
+      void unlock();
+
+      //----------------------------------------------------------------------
+      // Shared Locking
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Locks this mutex for shared ownership
+      void lock_shared();
+
+      /// \brief Tries to lock this mutex for shared ownership without
+      ///        waiting for a writer
+      ///
+      /// \return \c true if the lock is acquired
+      bool try_lock_shared() noexcept;
+
+      /// \brief Unlocks this mutex from shared ownership
+      void unlock_shared() noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      // The padding of the last slot keeps 'm_writer' off of the readers'
+      // lines
+      per_thread<std::atomic<std::size_t>,Slots> m_readers;
+      std::atomic<bool>                          m_writer;
+      adaptive_mutex                             m_writer_mutex;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Waits for every reader slot to drain
+      void wait_for_readers() noexcept;
+
+      /// \brief Checks whether any reader slot is occupied
+      bool has_readers() const noexcept;
+    };
+
+    //------------------------------------------------------------------------
+    // Aliases
+    //------------------------------------------------------------------------
+
+    /// \brief The default distributed shared mutex
+    using distributed_shared_mutex = basic_distributed_shared_mutex<32>;
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/distributed_shared_mutex.inl"
+
+#endif /* BIT_CONCURRENCY_LOCKS_DISTRIBUTED_SHARED_MUTEX_HPP */
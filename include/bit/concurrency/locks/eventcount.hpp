@@ -0,0 +1,199 @@
+/**
+ * \file eventcount.hpp
+ *
+ * \brief This header contains an eventcount, for blocking until an external
+ *        lock-free condition holds
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_LOCKS_EVENTCOUNT_HPP
+#define BIT_CONCURRENCY_LOCKS_EVENTCOUNT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "semaphore.hpp"
+#include "spin_lock.hpp"
+
+#include <atomic>  // std::atomic
+#include <chrono>  // std::chrono::time_point
+#include <cstdint> // std::uint32_t, std::uint64_t
+
+namespace bit {
+  namespace concurrency {
+    namespace detail {
+
+      /// \brief A thread parked on an eventcount
+      struct eventcount_waiter
+      {
+        eventcount_waiter() : parker(0), next(nullptr){}
+
+        semaphore          parker;
+        eventcount_waiter* next;
+      };
+
+    } // namespace detail
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief Blocks threads until a condition that lives outside of it
+    ///        changes, without a lost wakeup and without a lock on the fast
+    ///        path
+    ///
+    /// Unlike waitable_event and semaphore, an eventcount holds no state of
+    /// its own for the condition; it only orders waiters against notifiers.
+    /// A waiter announces itself before re-checking the condition, and
+    /// commits to sleeping only if the condition still does not hold:
+    ///
+    /// \code
+    /// while( !queue.try_pop(v) ) {
+    ///   const auto key = ec.prepare_wait();
+    ///   if( queue.try_pop(v) ) { ec.cancel_wait(); break; }
+    ///   ec.commit_wait( key );
+    /// }
+    /// \endcode
+    ///
+    /// and a notifier makes the condition true before notifying:
+    ///
+    /// \code
+    /// queue.push(v);
+    /// ec.notify_one();
+    /// \endcode
+    ///
+    /// Either the waiter's re-check sees the change, or the notifier sees the
+    /// waiter. Notifying when nobody waits costs a fence and a load; only
+    /// threads that actually park, and the notifies that find them, take a
+    /// spin_lock to queue and dequeue.
+    ///
+    /// Each thread parks on a semaphore of its own, so a wakeup can only go
+    /// to a thread that committed before the notify. A waiter can still
+    /// return without a matching notify, when a notify meant for others
+    /// advances the epoch between its prepare and commit; callers always
+    /// re-check the condition.
+    //////////////////////////////////////////////////////////////////////////
+    class eventcount
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      /// The epoch observed by prepare_wait
+      using key_type = std::uint32_t;
+
+      //----------------------------------------------------------------------
+      // Constructors / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an eventcount with no waiters
+      eventcount();
+
+      // Deleted copy constructor
+      eventcount( const eventcount& ) = delete;
+
+      // Deleted move constructor
+      eventcount( eventcount&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      eventcount& operator=( const eventcount& ) = delete;
+
+      // Deleted move assignment
+      eventcount& operator=( eventcount&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Waiting
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Announces the calling thread as a waiter
+      ///
+      /// The caller must re-check its condition after this, and then call
+      /// exactly one of commit_wait or cancel_wait.
+      ///
+      /// \return the key to pass to commit_wait
+      key_type prepare_wait() noexcept;
+
+      /// \brief Blocks until a notify that follows the prepare_wait that
+      ///        returned \p key
+      ///
+      /// Returns immediately if such a notify has already happened.
+      ///
+      /// \param key the key returned from prepare_wait
+      void commit_wait( key_type key );
+
+      /// \brief Blocks until a notify that follows the prepare_wait that
+      ///        returned \p key, or until \p time
+      ///
+      /// \param key the key returned from prepare_wait
+      /// \param time the time point to stop waiting
+      /// \return \c false if the wait timed out without a notify
+      template<typename Clock, typename Duration>
+      bool commit_wait_until( key_type key,
+                              const std::chrono::time_point<Clock,Duration>& time );
+
+      /// \brief Withdraws the calling thread as a waiter
+      void cancel_wait();
+
+      //----------------------------------------------------------------------
+      // Notifying
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Wakes one waiter, if any
+      ///
+      /// The condition must be made true before this is called.
+      void notify_one();
+
+      /// \brief Wakes every waiter
+      ///
+      /// The condition must be made true before this is called.
+      void notify_all();
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      // Bits [0,32) count the threads between prepare_wait and the end of
+      // their wait, and bits [32,64) are an epoch that advances with each
+      // notify that finds a waiter. Committed waiters are queued FIFO under
+      // 'm_lock'; the epoch only advances under it as well, so a waiter
+      // either sees the new epoch when it commits, or is queued in time for
+      // the notify to find it.
+      std::atomic<std::uint64_t> m_state;
+      spin_lock                  m_lock;
+      detail::eventcount_waiter* m_head;
+      detail::eventcount_waiter* m_tail;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Queues \p waiter, unless a notify has happened since the
+      ///        prepare_wait that returned \p key
+      ///
+      /// \return \c true if \p waiter was queued
+      bool enqueue( detail::eventcount_waiter& waiter, key_type key );
+
+      /// \brief Unlinks \p waiter after a timed-out wait
+      ///
+      /// \return \c false if a notify had already dequeued \p waiter
+      bool remove( detail::eventcount_waiter& waiter );
+
+      /// \brief Advances the epoch, and detaches up to \p count queued
+      ///        waiters
+      ///
+      /// \return the detached waiters, linked through 'next'
+      detail::eventcount_waiter* release( std::uint32_t count );
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/eventcount.inl"
+
+#endif /* BIT_CONCURRENCY_LOCKS_EVENTCOUNT_HPP */
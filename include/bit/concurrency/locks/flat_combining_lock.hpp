@@ -0,0 +1,255 @@
+/**
+ * \file flat_combining_lock.hpp
+ *
+ * \brief This header contains a flat-combining lock, which applies the
+ *        operations of waiting threads on their behalf
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_LOCKS_FLAT_COMBINING_LOCK_HPP
+#define BIT_CONCURRENCY_LOCKS_FLAT_COMBINING_LOCK_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/backoff.hpp"
+#include "../utilities/cache_aligned.hpp"
+#include "../utilities/per_thread.hpp"
+
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t
+#include <exception>   // std::exception_ptr
+#include <new>         // placement new
+#include <type_traits> // std::aligned_storage, std::is_reference, ...
+#include <utility>     // std::declval, std::move
+
+namespace bit {
+  namespace concurrency {
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief Storage for the result of an operation that is invoked on
+      ///        one thread and returned on another
+      ////////////////////////////////////////////////////////////////////////
+      template<typename R>
+      class combined_result
+      {
+      public:
+
+        combined_result() noexcept : m_has_value(false){}
+
+        ~combined_result()
+        {
+          if( m_has_value ) {
+            reinterpret_cast<R*>(&m_storage)->~R();
+          }
+        }
+
+        /// \brief Invokes \p fn with \p value, and stores the result
+        template<typename Fn, typename T>
+        void invoke( Fn& fn, T& value )
+        {
+          ::new (static_cast<void*>(&m_storage)) R( fn(value) );
+          m_has_value = true;
+        }
+
+        /// \brief Moves out the stored result
+        R get()
+        {
+          return std::move( *reinterpret_cast<R*>(&m_storage) );
+        }
+
+      private:
+
+        typename std::aligned_storage<sizeof(R),alignof(R)>::type m_storage;
+        bool m_has_value;
+      };
+
+      template<>
+      class combined_result<void>
+      {
+      public:
+
+        template<typename Fn, typename T>
+        void invoke( Fn& fn, T& value ){ fn(value); }
+
+        void get() noexcept{}
+      };
+
+    } // namespace detail
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A lock that guards a value of type \p T by delegating every
+    ///        operation to whichever thread holds it
+    ///
+    /// This is the flat-combining technique of Hendler, Incze, Shavit and
+    /// Tzafrir. A thread publishes its operation in a per-thread slot, and
+    /// then either acquires the lock or waits for its slot to be cleared.
+    /// The thread that acquires the lock becomes the combiner: it scans
+    /// every slot, applies each pending operation to the value, and writes
+    /// its result back to the slot before releasing the lock.
+    ///
+    /// Compared to a spin_lock around the same value, the value stays in
+    /// the combiner's cache for a whole batch of operations instead of
+    /// moving with every acquisition, and waiting threads spin only on
+    /// their own slot. This pays off for a structure that must be locked
+    /// as a whole and is updated by many threads at once, such as a
+    /// priority queue or a counter with side effects; uncontended, each
+    /// operation costs a little more than taking a spin_lock.
+    ///
+    /// Up to \p Slots threads each have a slot to themselves; further
+    /// threads share, taking turns to publish.
+    ///
+    /// Operations run on the combining thread, so they must not depend on
+    /// the identity or thread-local state of the calling thread, and must
+    /// not call apply() on the same lock.
+    ///
+    /// \tparam T the type of the guarded value
+    /// \tparam Slots the number of publication slots
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T, std::size_t Slots = 64>
+    class flat_combining_lock
+    {
+      template<typename Fn>
+      using apply_result = decltype(std::declval<Fn&>()(std::declval<T&>()));
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+      using size_type  = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a flat_combining_lock holding a value-initialized
+      ///        \p T
+      flat_combining_lock();
+
+      /// \brief Constructs a flat_combining_lock holding a copy of \p value
+      ///
+      /// \param value the initial value
+      explicit flat_combining_lock( const T& value );
+
+      /// \brief Constructs a flat_combining_lock holding \p value
+      ///
+      /// \param value the initial value
+      explicit flat_combining_lock( T&& value );
+
+      // Deleted copy constructor
+      flat_combining_lock( const flat_combining_lock& ) = delete;
+
+      // Deleted move constructor
+      flat_combining_lock( flat_combining_lock&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      flat_combining_lock& operator=( const flat_combining_lock& ) = delete;
+
+      // Deleted move assignment
+      flat_combining_lock& operator=( flat_combining_lock&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Operations
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Invokes \p fn with exclusive access to the value
+      ///
+      /// \p fn is invoked with a \c T&, possibly on another thread, and
+      /// returns once it has completed. An exception thrown by \p fn is
+      /// rethrown on the calling thread.
+      ///
+      /// \param fn the function to invoke
+      /// \return the result of \p fn, which must not be a reference
+      template<typename Fn>
+      apply_result<Fn> apply( Fn&& fn );
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief A published operation, which lives on the stack of the
+      ///        thread that published it
+      struct operation
+      {
+        /// Invokes the operation, storing its result or exception
+        void (*execute)( operation*, T& ) noexcept;
+
+        std::exception_ptr error;
+      };
+
+      template<typename Fn, typename R>
+      struct typed_operation : operation
+      {
+        explicit typed_operation( Fn& f ) noexcept;
+
+        static void execute_typed( operation* op, T& value ) noexcept;
+
+        Fn&                       fn;
+        detail::combined_result<R> result;
+      };
+
+      struct slot
+      {
+        /// The pending operation; cleared by the combiner once it has run
+        std::atomic<operation*> pending{nullptr};
+
+        /// Set while a thread is publishing through this slot
+        std::atomic<bool> claimed{false};
+      };
+
+      //----------------------------------------------------------------------
+      // Private Static Members
+      //----------------------------------------------------------------------
+    private:
+
+      /// The most scans of the slots by a single combiner, bounding how
+      /// long it can be kept from returning to its own caller
+      static constexpr size_type max_passes = 4;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::atomic<bool> m_locked;
+
+      /// One past the highest slot that has ever been published to
+      padded<std::atomic<size_type>> m_active;
+
+      /// Only touched by the combiner
+      padded<T> m_value;
+
+      per_thread<slot,Slots> m_slots;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Publishes \p op, and returns once it has run
+      void publish( operation& op );
+
+      /// \brief Attempts to acquire the lock and combine
+      ///
+      /// \return \c true if this thread combined
+      bool try_combine() noexcept;
+
+      /// \brief Runs the pending operations; the lock must be held
+      void combine() noexcept;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/flat_combining_lock.inl"
+
+#endif /* BIT_CONCURRENCY_LOCKS_FLAT_COMBINING_LOCK_HPP */
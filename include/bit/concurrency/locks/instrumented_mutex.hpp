@@ -0,0 +1,243 @@
+/**
+ * \file instrumented_mutex.hpp
+ *
+ * \brief This header contains a decorator that records acquisition, wait and
+ *        hold statistics for any lockable
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_LOCKS_INSTRUMENTED_MUTEX_HPP
+#define BIT_CONCURRENCY_LOCKS_INSTRUMENTED_MUTEX_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/per_thread.hpp"
+
+#include <array>       // std::array
+#include <atomic>      // std::atomic
+#include <chrono>      // std::chrono::steady_clock
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t
+#include <type_traits> // std::true_type, std::false_type
+#include <utility>     // std::declval
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A point-in-time copy of an instrumented_mutex's statistics
+    ///
+    /// Histogram bucket 0 counts durations under 1ns, and bucket \c i counts
+    /// durations in [2^(i-1), 2^i) nanoseconds; the last bucket also counts
+    /// everything longer.
+    //////////////////////////////////////////////////////////////////////////
+    struct lock_statistics
+    {
+      static constexpr std::size_t bucket_count = 32;
+
+      using histogram = std::array<std::uint64_t,bucket_count>;
+
+      std::uint64_t acquisitions;      ///< exclusive and shared
+      std::uint64_t contended;         ///< acquisitions that had to wait
+      std::uint64_t total_wait_ns;
+      std::uint64_t total_hold_ns;     ///< exclusive holds only
+      histogram     wait_histogram;
+      histogram     hold_histogram;    ///< exclusive holds only
+
+      /// \brief Returns the fraction of acquisitions that had to wait
+      ///
+      /// \return the contended fraction, or 0 if there were none
+      double contended_fraction() const noexcept;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief Wraps a lockable to record how often it is taken, how often
+    ///        taking it has to wait, and how long waits and holds last
+    ///
+    /// An acquisition first tries the lock; only if that fails is it counted
+    /// as contended and its wait timed. A lock without \c try_lock, such as
+    /// clh_lock, has every acquisition timed, and none counted as contended.
+    /// Shared acquisitions are counted and their waits recorded, but their
+    /// holds are not, since there is no single holder to time.
+    ///
+    /// Statistics are kept in \p Slots cache-line-sized stripes, and each
+    /// thread updates only the stripe it is assigned, so recording adds
+    /// relaxed increments to lines no other thread usually writes rather
+    /// than contention of its own. snapshot() sums the stripes.
+    ///
+    /// The decorator meets whichever of Lockable and SharedLockable the
+    /// underlying lock does.
+    ///
+    /// \tparam Mutex the lock to instrument
+    /// \tparam Slots the number of statistics stripes
+    //////////////////////////////////////////////////////////////////////////
+    template<typename Mutex, std::size_t Slots = 8>
+    class instrumented_mutex
+    {
+      static_assert( Slots > 0, "instrumented_mutex requires at least one slot" );
+
+      using clock = std::chrono::steady_clock;
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using mutex_type = Mutex;
+
+      //----------------------------------------------------------------------
+      // Constructors / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Default-constructs the underlying lock, with empty statistics
+      instrumented_mutex();
+
+      // Deleted copy constructor
+      instrumented_mutex( const instrumented_mutex& ) = delete;
+
+      // Deleted move constructor
+      instrumented_mutex( instrumented_mutex&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      instrumented_mutex& operator=( const instrumented_mutex& ) = delete;
+
+      // Deleted move assignment
+      instrumented_mutex& operator=( instrumented_mutex&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Locking
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Locks the underlying lock
+      void lock();
+
+      /// \brief Tries to lock the underlying lock
+      ///
+      /// A failed attempt is not recorded.
+      ///
+      /// \return \c true if the lock is acquired
+      bool try_lock();
+
+      /// \brief Unlocks the underlying lock
+      void unlock();
+
+      //----------------------------------------------------------------------
+      // Shared Locking
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Locks the underlying lock in shared mode
+      void lock_shared();
+
+      /// \brief Tries to lock the underlying lock in shared mode
+      ///
+      /// \return \c true if the lock is acquired
+      bool try_lock_shared();
+
+      /// \brief Unlocks the underlying lock from shared mode
+      void unlock_shared();
+
+      //----------------------------------------------------------------------
+      // Statistics
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Sums the statistics recorded so far
+      ///
+      /// Stripes are read one at a time while other threads may be
+      /// recording, so the totals need not agree exactly with each other.
+      ///
+      /// \return the statistics
+      lock_statistics snapshot() const noexcept;
+
+      /// \brief Clears the statistics
+      ///
+      /// Acquisitions recorded concurrently may be lost.
+      void reset() noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the underlying lock
+      ///
+      /// \return the underlying lock
+      mutex_type& native() noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      struct slot
+      {
+        std::atomic<std::uint64_t> acquisitions;
+        std::atomic<std::uint64_t> contended;
+        std::atomic<std::uint64_t> total_wait_ns;
+        std::atomic<std::uint64_t> total_hold_ns;
+        std::atomic<std::uint64_t> wait_histogram[lock_statistics::bucket_count];
+        std::atomic<std::uint64_t> hold_histogram[lock_statistics::bucket_count];
+      };
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      Mutex m_mutex;
+
+      // Written only by the exclusive holder
+      clock::time_point m_acquired_at;
+
+      // Threads are handed slots round-robin, so up to 'Slots' concurrent
+      // threads each record into a cache line of their own
+      per_thread<slot,Slots> m_slots;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Acquires \p mutex exclusively, trying it first
+      ///
+      /// \param wait set to the time spent waiting
+      /// \return \c true if the acquisition had to wait
+      template<typename M>
+      static bool acquire( M& mutex, clock::duration& wait, std::true_type );
+
+      /// \brief Acquires \p mutex exclusively, timing every acquisition
+      template<typename M>
+      static bool acquire( M& mutex, clock::duration& wait, std::false_type );
+
+      /// \brief Records an acquisition that waited for \p wait
+      void record_acquisition( clock::duration wait, bool contended ) noexcept;
+    };
+
+    namespace detail {
+
+      /// \brief Detects whether \c M has a \c try_lock member
+      template<typename M, typename = void>
+      struct is_try_lockable : std::false_type{};
+
+      template<typename M>
+      struct is_try_lockable<M,decltype(void(std::declval<M&>().try_lock()))>
+        : std::true_type{};
+
+      /// \brief Returns the histogram bucket of a duration of \p ns
+      ///        nanoseconds
+      std::size_t lock_statistics_bucket( std::uint64_t ns ) noexcept;
+
+    } // namespace detail
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/instrumented_mutex.inl"
+
+#endif /* BIT_CONCURRENCY_LOCKS_INSTRUMENTED_MUTEX_HPP */
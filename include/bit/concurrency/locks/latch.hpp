@@ -0,0 +1,101 @@
+/**
+ * \file latch.hpp
+ *
+ * \brief This header contains a single-use count-down latch
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_LOCKS_LATCH_HPP
+#define BIT_CONCURRENCY_LOCKS_LATCH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "eventcount.hpp"
+
+#include <atomic>  // std::atomic
+#include <cstddef> // std::ptrdiff_t
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A single-use counter that threads wait on until it reaches
+    ///        zero
+    ///
+    /// This mirrors C++20's std::latch. Counting down is a single atomic
+    /// decrement, and only the decrement that reaches zero touches the
+    /// waiters. Waiters park on an eventcount, and so on a semaphore.
+    //////////////////////////////////////////////////////////////////////////
+    class latch
+    {
+      //----------------------------------------------------------------------
+      // Constructors / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a latch that opens after \p expected count downs
+      ///
+      /// \param expected the initial count. Must not be negative
+      explicit latch( std::ptrdiff_t expected );
+
+      // Deleted copy constructor
+      latch( const latch& ) = delete;
+
+      // Deleted move constructor
+      latch( latch&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      latch& operator=( const latch& ) = delete;
+
+      // Deleted move assignment
+      latch& operator=( latch&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Counting
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Decrements the count by \p n, releasing the waiters if it
+      ///        reaches zero
+      ///
+      /// \param n the amount to decrement by. Must not exceed the count
+      void count_down( std::ptrdiff_t n = 1 );
+
+      //----------------------------------------------------------------------
+      // Waiting
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Checks whether the count has reached zero
+      ///
+      /// \return \c true if the count is zero
+      bool try_wait() const noexcept;
+
+      /// \brief Blocks until the count reaches zero
+      void wait() const;
+
+      /// \brief Decrements the count by \p n, and then blocks until it
+      ///        reaches zero
+      ///
+      /// \param n the amount to decrement by
+      void arrive_and_wait( std::ptrdiff_t n = 1 );
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::atomic<std::ptrdiff_t> m_count;
+      mutable eventcount          m_event;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/latch.inl"
+
+#endif /* BIT_CONCURRENCY_LOCKS_LATCH_HPP */
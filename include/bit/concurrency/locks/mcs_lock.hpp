@@ -0,0 +1,105 @@
+/**
+ * \file mcs_lock.hpp
+ *
+ * \brief This header contains an implementation of the Mellor-Crummey and
+ *        Scott (MCS) queue lock
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_LOCKS_MCS_LOCK_HPP
+#define BIT_CONCURRENCY_LOCKS_MCS_LOCK_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/lock_node_cache.hpp"
+
+#include "../utilities/backoff.hpp"
+#include "../utilities/cache_aligned.hpp"
+
+#include <atomic>
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A FIFO-fair queue lock where each waiter spins on its own node
+    ///
+    /// Waiters enqueue a node with a single exchange on the tail, and then
+    /// spin only on a flag within their own node until the predecessor hands
+    /// the lock over. The coherence traffic of a hand-over is therefore
+    /// constant, regardless of the number of waiters.
+    ///
+    /// Nodes are drawn from a cache local to the locking thread, so
+    /// \c unlock must be called from the thread that acquired the lock.
+    //////////////////////////////////////////////////////////////////////////
+    class mcs_lock
+    {
+      //------------------------------------------------------------------------
+      // Constructors / Assignment
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an unlocked mcs_lock
+      constexpr mcs_lock() noexcept;
+
+      // Deleted copy constructor
+      mcs_lock( const mcs_lock& ) = delete;
+
+      // Deleted move constructor
+      mcs_lock( mcs_lock&& ) = delete;
+
+      //------------------------------------------------------------------------
+
+      // Deleted copy assignment
+      mcs_lock& operator=( const mcs_lock& ) = delete;
+
+      // Deleted move assignment
+      mcs_lock& operator=( mcs_lock&& ) = delete;
+
+      //------------------------------------------------------------------------
+      // Locking
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Locks the mcs_lock, waiting for all earlier lockers
+      void lock();
+
+      /// \brief Tries the mcs_lock, returning whether the lock is acquired
+      ///
+      /// \return \c true if the lock is acquired
+      bool try_lock();
+
+      /// \brief Unlocks the mcs_lock, handing it to the next waiter
+      void unlock() noexcept;
+
+      //------------------------------------------------------------------------
+      // Private Member Types
+      //------------------------------------------------------------------------
+    private:
+
+      struct node : detail::cache_line_allocated
+      {
+        std::atomic<node*> next;   ///< the successor waiting on this node
+        std::atomic<bool>  locked; ///< whether the owner must keep waiting
+        node*              cache_next;
+      };
+
+      using node_cache = detail::lock_node_cache<node>;
+
+      //------------------------------------------------------------------------
+      // Private Members
+      //------------------------------------------------------------------------
+    private:
+
+      std::atomic<node*> m_tail;  ///< the last node in the queue
+      node*              m_owner; ///< the node of the owner; owner access only
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/mcs_lock.inl"
+
+#endif /* BIT_CONCURRENCY_LOCKS_MCS_LOCK_HPP */
@@ -35,6 +35,8 @@
   - Split into separate cpp files, rather than inline in a single header. This
     prevents polluting the current API by #include <windows.h> for windows
     targets
+  - Added a futex-backed implementation for linux targets, enabled with
+    BIT_CONCURRENCY_USE_FUTEX
 
  */
 #ifndef BIT_CONCURRENCY_LOCKS_SEMAPHORE_HPP
@@ -47,8 +49,14 @@
 #include <chrono>
 #include <cstdint>
 
+#if defined(__linux__) && defined(BIT_CONCURRENCY_USE_FUTEX)
+# define BIT_CONCURRENCY_SEMAPHORE_FUTEX 1
+#endif
+
 #if defined(__MACH__)
 #include <mach/semaphore.h> // ::semaphore_t
+#elif defined(BIT_CONCURRENCY_SEMAPHORE_FUTEX)
+#include <atomic> // std::atomic
 #elif defined(__unix__)
 #include <semaphore.h> // ::sem_t
 #elif defined(_WIN32)
@@ -79,6 +87,8 @@ namespace bit {
 
 #if defined(__MACH__)
       using native_handle_type = ::semaphore_t; ///< Semaphore type for mac
+#elif defined(BIT_CONCURRENCY_SEMAPHORE_FUTEX)
+      using native_handle_type = std::atomic<std::int32_t>*; ///< Futex word for linux
 #elif defined(__unix__) || defined(__unix)
       using native_handle_type = ::sem_t; ///< Semaphore type for *nix
 #elif defined(_WIN32) || defined(_WIN64)
@@ -169,7 +179,12 @@ namespace bit {
       //----------------------------------------------------------------------
     private:
 
+#if defined(BIT_CONCURRENCY_SEMAPHORE_FUTEX)
+      std::atomic<std::int32_t> m_count;   ///< the available count; the futex word
+      std::atomic<std::int32_t> m_waiters; ///< the number of threads parked on m_count
+#else
       native_handle_type m_semaphore; ///< the underlying semaphore
+#endif
 
       //----------------------------------------------------------------------
       // Private Member Functions
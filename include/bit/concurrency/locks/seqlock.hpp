@@ -0,0 +1,156 @@
+/**
+ * \file seqlock.hpp
+ *
+ * \brief This header contains a sequence lock for read-mostly snapshots of
+ *        trivially copyable data
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_LOCKS_SEQLOCK_HPP
+#define BIT_CONCURRENCY_LOCKS_SEQLOCK_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "spin_lock.hpp"
+
+#include "../utilities/backoff.hpp"
+
+#include <atomic>      // std::atomic, std::atomic_thread_fence
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uintptr_t
+#include <cstring>     // std::memcpy
+#include <mutex>       // std::lock_guard
+#include <type_traits> // std::is_trivially_copyable
+#include <utility>     // std::forward
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A sequence lock that guards a value of type \p T
+    ///
+    /// Readers never write to shared memory: they copy the value out
+    /// optimistically, and retry if a writer was active during the copy.
+    /// This makes reads cheaper than even a perfectly scalable reader lock,
+    /// at the cost of readers retrying while a write is in progress.
+    /// Writers are serialized by a \p Mutex.
+    ///
+    /// The value is stored as an array of relaxed atomic words, fenced as
+    /// described in Boehm's "Can Seqlocks Get Along With Programming
+    /// Language Memory Models?", so that a torn read is never a data race.
+    ///
+    /// \tparam T the type of the guarded value. Must be trivially copyable
+    ///           and default-constructible
+    /// \tparam Mutex the lock used to serialize writers
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T, typename Mutex = spin_lock>
+    class seqlock
+    {
+      static_assert( std::is_trivially_copyable<T>::value,
+                     "seqlock requires a trivially copyable type" );
+      static_assert( std::is_default_constructible<T>::value,
+                     "seqlock requires a default-constructible type" );
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+      using mutex_type = Mutex;
+
+      //----------------------------------------------------------------------
+      // Constructors / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a seqlock holding a value-initialized \p T
+      seqlock();
+
+      /// \brief Constructs a seqlock holding \p value
+      ///
+      /// \param value the initial value
+      explicit seqlock( const T& value );
+
+      // Deleted copy constructor
+      seqlock( const seqlock& ) = delete;
+
+      // Deleted move constructor
+      seqlock( seqlock&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      seqlock& operator=( const seqlock& ) = delete;
+
+      // Deleted move assignment
+      seqlock& operator=( seqlock&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Reading
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Reads a consistent snapshot of the value
+      ///
+      /// \return a copy of the value
+      T load() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Writing
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Replaces the value with \p value
+      ///
+      /// \param value the value to store
+      void store( const T& value );
+
+      /// \brief Modifies the value in place by invoking \p fn on it
+      ///
+      /// \p fn is invoked with a \c T& while holding the writer lock, and the
+      /// result is published to readers as a single update.
+      ///
+      /// \param fn the function to invoke
+      template<typename Fn>
+      void write( Fn&& fn );
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      using word_type = std::uintptr_t;
+
+      static constexpr std::size_t word_count =
+        (sizeof(T) + sizeof(word_type) - 1) / sizeof(word_type);
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::atomic<std::size_t> m_sequence; ///< odd while a write is active
+      std::atomic<word_type>   m_data[word_count];
+      Mutex                    m_mutex;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Publishes \p value; the writer lock must be held
+      void publish( const T& value ) noexcept;
+
+      /// \brief Reads the value; the writer lock must be held
+      T read_locked() const noexcept;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/seqlock.inl"
+
+#endif /* BIT_CONCURRENCY_LOCKS_SEQLOCK_HPP */
@@ -13,6 +13,8 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include "../utilities/backoff.hpp"
+
 #include <atomic>
 
 namespace bit {
@@ -23,30 +25,45 @@ namespace bit {
     ///
     /// This uses atomics, and thus may be heavier for systems with software
     /// atomics like older ARM architectures.
+    ///
+    /// Acquisition uses test-and-test-and-set: contended waiters spin on a
+    /// plain load, which keeps the cache line shared, and only attempt the
+    /// read-modify-write once the lock is observed to be free. Each failed
+    /// attempt invokes the \p Backoff policy.
+    ///
+    /// \tparam Backoff the backoff policy to use between failed attempts
     //////////////////////////////////////////////////////////////////////////
-    class spin_lock
+    template<typename Backoff>
+    class basic_spin_lock
     {
+      //------------------------------------------------------------------------
+      // Public Member Types
+      //------------------------------------------------------------------------
+    public:
+
+      using backoff_type = Backoff;
+
       //------------------------------------------------------------------------
       // Constructors / Assignment
       //------------------------------------------------------------------------
     public:
 
       /// \brief Constructs a basic SpinLock
-      spin_lock() noexcept;
+      constexpr basic_spin_lock() noexcept;
 
       // Deleted copy constructor
-      spin_lock( const spin_lock& ) = delete;
+      basic_spin_lock( const basic_spin_lock& ) = delete;
 
       // Deleted move constructor
-      spin_lock( spin_lock&& ) = delete;
+      basic_spin_lock( basic_spin_lock&& ) = delete;
 
       //------------------------------------------------------------------------
 
       // Deleted copy assignment
-      spin_lock& operator=( const spin_lock& ) = delete;
+      basic_spin_lock& operator=( const basic_spin_lock& ) = delete;
 
       // Deleted move assignment
-      spin_lock& operator=( spin_lock&& ) = delete;
+      basic_spin_lock& operator=( basic_spin_lock&& ) = delete;
 
       //------------------------------------------------------------------------
       // Locking
@@ -69,10 +86,20 @@ namespace bit {
       //------------------------------------------------------------------------
     private:
 
-      std::atomic_flag m_lock; ///< The atomic flag to use for locking
+      std::atomic<bool> m_lock; ///< The atomic flag to use for locking
     };
 
-  } // namespace platform
+    //------------------------------------------------------------------------
+    // Aliases
+    //------------------------------------------------------------------------
+
+    /// \brief The default spin lock, which backs off exponentially with
+    ///        cpu_relax() before falling back to yielding
+    using spin_lock = basic_spin_lock<exponential_backoff<>>;
+
+  } // namespace concurrency
 } // namespace bit
 
+#include "detail/spin_lock.inl"
+
 #endif /* BIT_CONCURRENCY_LOCKS_SPIN_LOCK_HPP */
@@ -30,6 +30,7 @@
 
   ALTERATIONS:
   - Added timed waiting
+  - Replaced the fixed spin count with an adaptive spin_budget
 */
 #ifndef BIT_CONCURRENCY_LOCKS_SPINNING_SEMAPHORE_HPP
 #define BIT_CONCURRENCY_LOCKS_SPINNING_SEMAPHORE_HPP
@@ -40,6 +41,9 @@
 
 #include "semaphore.hpp"
 
+#include "../utilities/backoff.hpp"
+#include "../utilities/spin_budget.hpp"
+
 #include <atomic>
 #include <cassert>
 #include <chrono>
@@ -51,6 +55,8 @@ namespace bit {
     /// \brief A lightweight semaphore that uses partial spinning to avoid
     ///        yielding processor time-slices and causing context switches
     ///
+    /// The length of the spin is bounded by a spin_budget that adapts to
+    /// how long recent waits actually took.
     ///////////////////////////////////////////////////////////////////////////
     class spinning_semaphore
     {
@@ -127,6 +133,7 @@ namespace bit {
     private:
 
       std::atomic<int> m_count;
+      spin_budget      m_spin;
       semaphore        m_semaphore;
 
       //-----------------------------------------------------------------------
@@ -138,6 +145,8 @@ namespace bit {
 
       template<typename Rep, typename Period>
       bool try_partial_spin_wait( const duration<Rep,Period>& duration );
+
+      bool cancel_wait();
     };
 
   } // namespace concurrency
@@ -0,0 +1,187 @@
+/**
+ * \file striped_lock.hpp
+ *
+ * \brief This header contains a fixed table of locks that guards an
+ *        unbounded set of keys
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_LOCKS_STRIPED_LOCK_HPP
+#define BIT_CONCURRENCY_LOCKS_STRIPED_LOCK_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/cache_aligned.hpp"
+
+#include <array>      // std::array
+#include <cstddef>    // std::size_t
+#include <functional> // std::hash
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief \p Stripes padded locks, of which each key is guarded by the
+    ///        one its hash selects
+    ///
+    /// Striping sits between one lock per object, which costs memory for
+    /// every object, and one lock for all of them, which serializes every
+    /// access. Keys that hash to different stripes never contend; keys that
+    /// hash to the same one share a lock, so the lock must never be held
+    /// while waiting for another key's, except through lock_many.
+    ///
+    /// Hashes are mixed before being reduced to a stripe, so identity hashes
+    /// of sequential keys, such as std::hash of an integer, still spread
+    /// evenly.
+    ///
+    /// A single stripe is locked through the lock that stripe_for returns,
+    /// with std::lock_guard, std::unique_lock, or std::shared_lock when the
+    /// \p Mutex is SharedLockable. Several keys are locked together with
+    /// lock_many, which takes their stripes in ascending order, each once,
+    /// so that any two calls agree on the order and cannot deadlock.
+    ///
+    /// \tparam Mutex the lock of each stripe
+    /// \tparam Stripes the number of stripes
+    //////////////////////////////////////////////////////////////////////////
+    template<typename Mutex, std::size_t Stripes = 64>
+    class striped_lock
+    {
+      static_assert( Stripes > 0, "striped_lock requires at least one stripe" );
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using mutex_type = Mutex;
+      using size_type  = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Constructors / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Default-constructs every stripe's lock
+      striped_lock() = default;
+
+      // Deleted copy constructor
+      striped_lock( const striped_lock& ) = delete;
+
+      // Deleted move constructor
+      striped_lock( striped_lock&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      striped_lock& operator=( const striped_lock& ) = delete;
+
+      // Deleted move assignment
+      striped_lock& operator=( striped_lock&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Stripes
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the index of the stripe that guards \p key
+      ///
+      /// \param key the key, hashed with std::hash
+      /// \return the stripe index
+      template<typename Key>
+      size_type index_for( const Key& key ) const noexcept;
+
+      /// \brief Gets the index of the stripe that guards keys with the
+      ///        hash \p hash
+      ///
+      /// \param hash the hash of the key
+      /// \return the stripe index
+      size_type index_for_hash( std::size_t hash ) const noexcept;
+
+      /// \brief Gets the lock that guards \p key
+      ///
+      /// \param key the key, hashed with std::hash
+      /// \return the lock
+      template<typename Key>
+      mutex_type& stripe_for( const Key& key ) noexcept;
+
+      /// \brief Gets the lock of the stripe at \p index
+      ///
+      /// \param index the stripe, in [0, size())
+      /// \return the lock
+      mutex_type& stripe( size_type index ) noexcept;
+
+      /// \brief Returns the number of stripes
+      ///
+      /// \return \p Stripes
+      static constexpr size_type size() noexcept;
+
+      //----------------------------------------------------------------------
+      // Locking
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Locks the stripes of every key in \p keys, in ascending
+      ///        order, taking a stripe shared by several keys once
+      ///
+      /// If a lock throws, the stripes already taken are released before
+      /// the exception propagates.
+      ///
+      /// \param keys the keys, each hashed with std::hash
+      template<typename...Keys>
+      void lock_many( const Keys&...keys );
+
+      /// \brief Unlocks the stripes of every key in \p keys
+      ///
+      /// \param keys the keys passed to lock_many
+      template<typename...Keys>
+      void unlock_many( const Keys&...keys );
+
+      /// \brief Locks the stripes of every key in \p keys in shared mode,
+      ///        in ascending order
+      ///
+      /// \param keys the keys, each hashed with std::hash
+      template<typename...Keys>
+      void lock_shared_many( const Keys&...keys );
+
+      /// \brief Unlocks the stripes of every key in \p keys from shared
+      ///        mode
+      ///
+      /// \param keys the keys passed to lock_shared_many
+      template<typename...Keys>
+      void unlock_shared_many( const Keys&...keys );
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      template<std::size_t N>
+      using index_array = std::array<size_type,N>;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      padded<Mutex> m_stripes[Stripes];
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Sorts \p indices, and moves the distinct ones to the front
+      ///
+      /// \return the number of distinct indices
+      template<std::size_t N>
+      static size_type sort_unique( index_array<N>& indices ) noexcept;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/striped_lock.inl"
+
+#endif /* BIT_CONCURRENCY_LOCKS_STRIPED_LOCK_HPP */
@@ -0,0 +1,96 @@
+/**
+ * \file ticket_lock.hpp
+ *
+ * \brief This header contains an implementation of a FIFO-fair ticket lock
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_LOCKS_TICKET_LOCK_HPP
+#define BIT_CONCURRENCY_LOCKS_TICKET_LOCK_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../utilities/backoff.hpp"
+#include "../utilities/cache_aligned.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A busy-waiting lock that grants ownership in the order it was
+    ///        requested
+    ///
+    /// Each locker draws a ticket, and waits until the ticket is served.
+    /// Waiters back off in proportion to their distance from the front of
+    /// the queue, which limits the traffic on the shared 'serving' counter.
+    ///
+    /// Because ownership is handed over in strict order, a preempted waiter
+    /// stalls every waiter behind it; waiters eventually yield to let it
+    /// run, but this lock is best suited to systems where threads are not
+    /// oversubscribed.
+    //////////////////////////////////////////////////////////////////////////
+    class ticket_lock
+    {
+      //------------------------------------------------------------------------
+      // Constructors / Assignment
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an unlocked ticket_lock
+      constexpr ticket_lock() noexcept;
+
+      // Deleted copy constructor
+      ticket_lock( const ticket_lock& ) = delete;
+
+      // Deleted move constructor
+      ticket_lock( ticket_lock&& ) = delete;
+
+      //------------------------------------------------------------------------
+
+      // Deleted copy assignment
+      ticket_lock& operator=( const ticket_lock& ) = delete;
+
+      // Deleted move assignment
+      ticket_lock& operator=( ticket_lock&& ) = delete;
+
+      //------------------------------------------------------------------------
+      // Locking
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Locks the ticket_lock, waiting for all earlier lockers
+      void lock() noexcept;
+
+      /// \brief Tries the ticket_lock, returning whether the lock is acquired
+      ///
+      /// This only succeeds if there are no other holders or waiters.
+      ///
+      /// \return \c true if the lock is acquired
+      bool try_lock() noexcept;
+
+      /// \brief Unlocks the ticket_lock, handing it to the next waiter
+      void unlock() noexcept;
+
+      //------------------------------------------------------------------------
+      // Private Members
+      //------------------------------------------------------------------------
+    private:
+
+      /// The next ticket to hand out
+      padded<std::atomic<std::uint32_t>> m_next;
+
+      /// The ticket currently holding the lock
+      padded<std::atomic<std::uint32_t>> m_serving;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/ticket_lock.inl"
+
+#endif /* BIT_CONCURRENCY_LOCKS_TICKET_LOCK_HPP */
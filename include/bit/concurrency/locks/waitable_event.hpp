@@ -1,6 +1,6 @@
 /*****************************************************************************
  * \file
- * \brief TODO: Add description
+ * \brief This header contains an automatic and manual reset event
  *****************************************************************************/
 
 /*
@@ -33,9 +33,12 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
-#include <chrono>             // std::chrono::duration, std::chrono::time_point
-#include <mutex>              // std::mutex, std::unique_lock
-#include <condition_variable> // std::condition_variable
+#include "eventcount.hpp"
+#include "semaphore.hpp"
+
+#include <atomic>  // std::atomic
+#include <chrono>  // std::chrono::duration, std::chrono::time_point
+#include <cstdint> // std::int64_t
 
 namespace bit {
   namespace concurrency {
@@ -44,18 +47,49 @@ namespace bit {
     /// \brief A simple waitable event that helps manage waiting for a valid
     ///        signal condition.
     ///
-    /// A waitable_event converts a std::mutex's API into a signaling
-    /// semaphore API.
+    /// The state of the event is a single atomic word, so signaling an event
+    /// that nobody is waiting on never blocks and never enters the kernel.
+    /// Waiters on an automatic-reset event park on a semaphore, which is
+    /// futex-backed on linux; waiters on a manual-reset event park on an
+    /// eventcount.
+    ///
+    /// An event is created in one of two modes:
+    ///
+    /// - reset_mode::automatic: each signal releases exactly one waiter. If
+    ///   there are no waiters, the event stays signaled until the next
+    ///   waiter consumes it.
+    /// - reset_mode::manual: a signal releases every waiter, and the event
+    ///   stays signaled until it is explicitly reset.
     //////////////////////////////////////////////////////////////////////////
     class waitable_event
     {
+      template<typename Rep, typename Period>
+      using duration = std::chrono::duration<Rep,Period>;
+
+      template<typename Clock, typename Duration>
+      using time_point = std::chrono::time_point<Clock,Duration>;
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief The behaviour of the event once it has been signaled
+      enum class reset_mode
+      {
+        automatic, ///< Wake a single waiter, and reset
+        manual,    ///< Wake all waiters, and stay signaled until reset()
+      };
+
       //----------------------------------------------------------------------
       // Constructors / Assignment
       //----------------------------------------------------------------------
     public:
 
       /// \brief Default constructs a waitable_event that is not yet signaled
-      waitable_event();
+      ///
+      /// \param mode the reset behaviour of this event
+      explicit waitable_event( reset_mode mode = reset_mode::automatic );
 
       // Deleted move constructor
       waitable_event( waitable_event&& other ) = delete;
@@ -79,38 +113,93 @@ namespace bit {
       /// \brief Blocks the current thread until it is signaled
       void wait();
 
+      /// \brief Checks whether the event is signaled without blocking
+      ///
+      /// An automatic-reset event is reset if this succeeds.
+      ///
+      /// \return \c true if the event was signaled
+      bool try_wait() noexcept;
+
       /// \brief Blocks the current thread until it is signaled, or until the
       ///        specified duration has been waited for
       ///
       /// \param duration the amount of time to wait for
       /// \return \c true if the event was woken up because it was signaled
       template<typename Rep, typename Period>
-      bool wait_for( const std::chrono::duration<Rep,Period>& duration );
+      bool wait_for( const duration<Rep,Period>& duration );
 
       /// \brief Blocks the current thread until it is signaled, or until the
-      ///        specified \p time_out has been reached
+      ///        specified \p time_point has been reached
       ///
-      /// \param time_out the time to wait until
+      /// \param time_point the time to wait until
       /// \return \c true if the event was woken up because it was signaled
       template<typename Clock, typename Duration>
-      bool wait_until( const std::chrono::time_point<Clock,Duration>& time_point );
+      bool wait_until( const time_point<Clock,Duration>& time_point );
 
       //----------------------------------------------------------------------
       // Signaling
       //----------------------------------------------------------------------
     public:
 
-      /// \brief Signals for this waitable_event to stop waiting
+      /// \brief Signals this waitable_event
+      ///
+      /// An automatic-reset event wakes at most one waiter; a manual-reset
+      /// event wakes all current waiters.
       void signal();
 
+      /// \brief Resets this waitable_event to the non-signaled state
+      void reset() noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the reset behaviour of this event
+      ///
+      /// \return the reset mode
+      reset_mode mode() const noexcept;
+
       //----------------------------------------------------------------------
       // Private Members
       //----------------------------------------------------------------------
     private:
 
-      std::mutex              m_mutex;
-      std::condition_variable m_cv;
-      bool                    m_signal;
+      // In automatic mode, the state is 1 when signaled, 0 when reset, and
+      // -N when N threads are waiting. A signal that releases a waiter posts
+      // a permit to the semaphore, and any waiter may take it.
+      //
+      // In manual mode, bit 0 is the signaled flag, and the remaining bits
+      // are a generation that advances with each signal, which lets a waiter
+      // tell whether it was released even if the event was reset since.
+      // The eventcount only wakes threads that parked before the signal, so
+      // a waiter never consumes the wakeup of another generation.
+      std::atomic<std::int64_t> m_state;
+      reset_mode                m_mode;
+      semaphore                 m_semaphore;
+      eventcount                m_event;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Registers as a waiter, unless the event is already signaled
+      ///
+      /// \param generation set to the generation registered in (manual only)
+      /// \return \c true if the event was already signaled
+      bool register_wait( std::int64_t& generation ) noexcept;
+
+      /// \brief Checks whether a manual-reset waiter was released
+      ///
+      /// \param generation the generation returned from register_wait
+      /// \return \c true if the event was signaled since registering
+      bool is_released( std::int64_t generation ) const noexcept;
+
+      /// \brief Withdraws a timed-out waiter of an automatic-reset event
+      ///
+      /// \return \c true if the waiter had been released regardless
+      bool cancel_wait();
     };
 
   } // namespace concurrency
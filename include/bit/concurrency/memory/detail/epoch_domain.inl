@@ -0,0 +1,87 @@
+#ifndef BIT_CONCURRENCY_MEMORY_DETAIL_EPOCH_DOMAIN_INL
+#define BIT_CONCURRENCY_MEMORY_DETAIL_EPOCH_DOMAIN_INL
+
+//============================================================================
+// epoch_domain
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Private Static Member Functions
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::concurrency::epoch_domain::delete_pointer( void* p )
+{
+  delete static_cast<T*>(p);
+}
+
+//============================================================================
+// epoch_domain::participant
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Critical Regions
+//----------------------------------------------------------------------------
+
+inline void bit::concurrency::epoch_domain::participant::enter()
+  noexcept
+{
+  if( m_record->nesting++ != 0 ) return;
+
+  const auto epoch = m_domain->m_epoch->load(std::memory_order_relaxed);
+
+  // Released so that a scan that observes this pin also observes the end of
+  // this participant's previous region
+  m_record->state.store((epoch << 1) | 1u, std::memory_order_release);
+
+  // The pin must be visible before any shared node is read; this pairs with
+  // the fence in 'try_advance', so that either the advancing thread sees
+  // this pin, or this thread sees every unlink that preceded the advance.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+inline void bit::concurrency::epoch_domain::participant::exit()
+  noexcept
+{
+  if( --m_record->nesting != 0 ) return;
+
+  m_record->state.store(0, std::memory_order_release);
+}
+
+inline bool bit::concurrency::epoch_domain::participant::in_critical_region()
+  const noexcept
+{
+  return m_record->nesting != 0;
+}
+
+//----------------------------------------------------------------------------
+// Reclamation
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::concurrency::epoch_domain::participant::retire( T* pointer )
+{
+  retire( pointer, &epoch_domain::delete_pointer<T> );
+}
+
+//============================================================================
+// epoch_domain::guard
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor / Destructor
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::epoch_domain::guard::guard( participant& p )
+  noexcept
+  : m_participant(p)
+{
+  m_participant.enter();
+}
+
+inline bit::concurrency::epoch_domain::guard::~guard()
+{
+  m_participant.exit();
+}
+
+#endif /* BIT_CONCURRENCY_MEMORY_DETAIL_EPOCH_DOMAIN_INL */
@@ -0,0 +1,98 @@
+#ifndef BIT_CONCURRENCY_MEMORY_DETAIL_HAZARD_POINTER_DOMAIN_INL
+#define BIT_CONCURRENCY_MEMORY_DETAIL_HAZARD_POINTER_DOMAIN_INL
+
+//============================================================================
+// hazard_pointer_domain
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline std::size_t bit::concurrency::hazard_pointer_domain::hazards()
+  const noexcept
+{
+  return m_hazards;
+}
+
+//----------------------------------------------------------------------------
+// Private Static Member Functions
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::concurrency::hazard_pointer_domain::delete_pointer( void* p )
+{
+  delete static_cast<T*>(p);
+}
+
+//============================================================================
+// hazard_pointer_domain::participant
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Protection
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline T* bit::concurrency::hazard_pointer_domain::participant
+  ::protect( std::size_t index, const std::atomic<T*>& source )
+  noexcept
+{
+  auto* pointer = source.load(std::memory_order_relaxed);
+
+  while( true ) {
+    set( index, pointer );
+
+    // The node is only safe if it was still reachable after the hazard was
+    // published; otherwise a scan may have already missed it
+    auto* current = source.load(std::memory_order_acquire);
+
+    if( current == pointer ) return pointer;
+
+    pointer = current;
+  }
+}
+
+inline void bit::concurrency::hazard_pointer_domain::participant
+  ::set( std::size_t index, void* pointer )
+  noexcept
+{
+  assert( index < m_domain->m_hazards );
+
+  m_record->hazards[index].store(pointer, std::memory_order_relaxed);
+
+  // The hazard must be visible before the pointer is re-validated; this
+  // pairs with the fence in 'collect', so that either the scan sees this
+  // hazard, or this thread sees the unlink that preceded the scan.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+inline void bit::concurrency::hazard_pointer_domain::participant
+  ::clear( std::size_t index )
+  noexcept
+{
+  assert( index < m_domain->m_hazards );
+
+  m_record->hazards[index].store(nullptr, std::memory_order_release);
+}
+
+inline void bit::concurrency::hazard_pointer_domain::participant::clear()
+  noexcept
+{
+  for( auto i = std::size_t(0); i < m_domain->m_hazards; ++i ) {
+    m_record->hazards[i].store(nullptr, std::memory_order_release);
+  }
+}
+
+//----------------------------------------------------------------------------
+// Reclamation
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline void bit::concurrency::hazard_pointer_domain::participant
+  ::retire( T* pointer )
+{
+  retire( pointer, &hazard_pointer_domain::delete_pointer<T> );
+}
+
+#endif /* BIT_CONCURRENCY_MEMORY_DETAIL_HAZARD_POINTER_DOMAIN_INL */
@@ -0,0 +1,304 @@
+#ifndef BIT_CONCURRENCY_MEMORY_DETAIL_OBJECT_POOL_INL
+#define BIT_CONCURRENCY_MEMORY_DETAIL_OBJECT_POOL_INL
+
+#include <cassert>
+#include <mutex>   // std::lock_guard
+#include <new>     // std::bad_alloc, std::nothrow, placement new
+#include <utility> // std::forward, std::swap
+
+//----------------------------------------------------------------------------
+// Static Members
+//----------------------------------------------------------------------------
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+constexpr typename bit::concurrency::object_pool<T,MagazineSize,Slots>::size_type
+  bit::concurrency::object_pool<T,MagazineSize,Slots>::default_slab_size;
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+constexpr typename bit::concurrency::object_pool<T,MagazineSize,Slots>::size_type
+  bit::concurrency::object_pool<T,MagazineSize,Slots>::first_block_size;
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+constexpr typename bit::concurrency::object_pool<T,MagazineSize,Slots>::size_type
+  bit::concurrency::object_pool<T,MagazineSize,Slots>::max_blocks;
+
+//----------------------------------------------------------------------------
+// Constructor / Destructor
+//----------------------------------------------------------------------------
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+inline bit::concurrency::object_pool<T,MagazineSize,Slots>
+  ::object_pool( size_type slab_size )
+  : m_full(0),
+    m_empty(0),
+    m_blocks(),
+    m_lock(),
+    m_slabs(),
+    m_unused(nullptr),
+    m_unused_end(nullptr),
+    m_free(nullptr),
+    m_slab_size(slab_size),
+    m_magazines(0),
+    m_caches()
+{
+  assert( slab_size > 0 );
+}
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+inline bit::concurrency::object_pool<T,MagazineSize,Slots>::~object_pool()
+{
+  // Every magazine, cached or in the depot, lives in a block
+  for( auto& block : *m_blocks ) {
+    delete[] block.load(std::memory_order_relaxed);
+  }
+}
+
+//----------------------------------------------------------------------------
+// Allocation
+//----------------------------------------------------------------------------
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+inline void* bit::concurrency::object_pool<T,MagazineSize,Slots>::allocate()
+{
+  auto& c = m_caches.local();
+  std::lock_guard<spin_lock> lock(c.lock);
+
+  if( c.loaded != nullptr && c.loaded->count != 0 ) {
+    return c.loaded->rounds[--c.loaded->count];
+  }
+  if( c.previous != nullptr && c.previous->count != 0 ) {
+    std::swap( c.loaded, c.previous );
+    return c.loaded->rounds[--c.loaded->count];
+  }
+
+  // Both magazines are empty; trade one for a full magazine from the depot
+  auto* full = pop( *m_full );
+  if( full != nullptr ) {
+    if( c.previous != nullptr ) {
+      push( *m_empty, c.previous );
+    }
+    c.previous = c.loaded;
+    c.loaded   = full;
+    return c.loaded->rounds[--c.loaded->count];
+  }
+
+  if( c.loaded == nullptr ) {
+    c.loaded = empty_magazine();
+    if( c.loaded == nullptr ) throw std::bad_alloc();
+  }
+  refill( *c.loaded );
+
+  return c.loaded->rounds[--c.loaded->count];
+}
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+inline void bit::concurrency::object_pool<T,MagazineSize,Slots>
+  ::deallocate( void* p )
+  noexcept
+{
+  auto& c = m_caches.local();
+  std::lock_guard<spin_lock> lock(c.lock);
+
+  if( c.loaded != nullptr && c.loaded->count != MagazineSize ) {
+    c.loaded->rounds[c.loaded->count++] = p;
+    return;
+  }
+  if( c.previous != nullptr && c.previous->count != MagazineSize ) {
+    std::swap( c.loaded, c.previous );
+    c.loaded->rounds[c.loaded->count++] = p;
+    return;
+  }
+
+  // Both magazines are full; trade one for an empty magazine, which is
+  // how a batch of objects freed on this thread reaches other threads
+  auto* empty = empty_magazine();
+  if( empty == nullptr ) {
+    release( p );
+    return;
+  }
+  if( c.previous != nullptr ) {
+    push( *m_full, c.previous );
+  }
+  c.previous = c.loaded;
+  c.loaded   = empty;
+  c.loaded->rounds[c.loaded->count++] = p;
+}
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+template<typename...Args>
+inline T* bit::concurrency::object_pool<T,MagazineSize,Slots>
+  ::construct( Args&&...args )
+{
+  auto* p = allocate();
+
+  try {
+    return ::new(p) T( std::forward<Args>(args)... );
+  } catch( ... ) {
+    deallocate( p );
+    throw;
+  }
+}
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+inline void bit::concurrency::object_pool<T,MagazineSize,Slots>
+  ::destroy( T* p )
+  noexcept
+{
+  p->~T();
+  deallocate( p );
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+inline void bit::concurrency::object_pool<T,MagazineSize,Slots>
+  ::push( stack_head& stack, magazine* m )
+  noexcept
+{
+  auto head = stack.load(std::memory_order_relaxed);
+  auto next = std::uint64_t();
+
+  do {
+    m->next.store( static_cast<std::uint32_t>(head), std::memory_order_relaxed );
+    next = ((head >> 32) + 1) << 32 | (m->index + std::uint64_t(1));
+  } while( !stack.compare_exchange_weak( head, next,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed ) );
+}
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+inline typename bit::concurrency::object_pool<T,MagazineSize,Slots>::magazine*
+  bit::concurrency::object_pool<T,MagazineSize,Slots>::pop( stack_head& stack )
+  noexcept
+{
+  auto head = stack.load(std::memory_order_acquire);
+  auto* m = static_cast<magazine*>(nullptr);
+  auto next = std::uint64_t();
+
+  do {
+    const auto top = static_cast<std::uint32_t>(head);
+    if( top == 0 ) return nullptr;
+
+    // 'm' may be popped and pushed elsewhere before the exchange, which
+    // then fails on the tag; magazines are never freed, so reading its
+    // 'next' is safe either way
+    m = magazine_at( top - 1 );
+    next = ((head >> 32) + 1) << 32 | m->next.load(std::memory_order_relaxed);
+  } while( !stack.compare_exchange_weak( head, next,
+                                         std::memory_order_acquire,
+                                         std::memory_order_acquire ) );
+  return m;
+}
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+inline typename bit::concurrency::object_pool<T,MagazineSize,Slots>::magazine*
+  bit::concurrency::object_pool<T,MagazineSize,Slots>
+  ::magazine_at( std::uint32_t index )
+  const noexcept
+{
+  // Block 'b' holds the indices from first_block_size * (2^b - 1)
+  auto q = index / first_block_size + 1;
+  auto block = size_type(0);
+
+  while( q >>= 1 ) {
+    ++block;
+  }
+
+  const auto offset = index - first_block_size * ((size_type(1) << block) - 1);
+
+  return (*m_blocks)[block].load(std::memory_order_acquire) + offset;
+}
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+inline typename bit::concurrency::object_pool<T,MagazineSize,Slots>::magazine*
+  bit::concurrency::object_pool<T,MagazineSize,Slots>::make_magazine()
+  noexcept
+{
+  std::lock_guard<spin_lock> lock(m_lock);
+
+  const auto index = m_magazines;
+  auto q = index / first_block_size + 1;
+  auto block = size_type(0);
+
+  while( q >>= 1 ) {
+    ++block;
+  }
+
+  if( block >= max_blocks ) return nullptr;
+
+  const auto start = first_block_size * ((size_type(1) << block) - 1);
+  auto* magazines = (*m_blocks)[block].load(std::memory_order_relaxed);
+
+  if( magazines == nullptr ) {
+    const auto size = first_block_size << block;
+
+    magazines = new (std::nothrow) magazine[size];
+    if( magazines == nullptr ) return nullptr;
+
+    for( auto i = size_type(0); i != size; ++i ) {
+      magazines[i].index = static_cast<std::uint32_t>(start + i);
+    }
+
+    // Published before any of its magazines can reach the depot
+    (*m_blocks)[block].store( magazines, std::memory_order_release );
+  }
+
+  ++m_magazines;
+  return magazines + (index - start);
+}
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+inline typename bit::concurrency::object_pool<T,MagazineSize,Slots>::magazine*
+  bit::concurrency::object_pool<T,MagazineSize,Slots>::empty_magazine()
+  noexcept
+{
+  auto* m = pop( *m_empty );
+
+  return (m != nullptr) ? m : make_magazine();
+}
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+inline void bit::concurrency::object_pool<T,MagazineSize,Slots>
+  ::refill( magazine& m )
+{
+  std::lock_guard<spin_lock> lock(m_lock);
+
+  while( m.count != MagazineSize && m_free != nullptr ) {
+    m.rounds[m.count++] = m_free;
+    m_free = m_free->next;
+  }
+
+  if( m.count == MagazineSize ) return;
+
+  if( m_unused == m_unused_end ) {
+    // A partial refill is enough; only an empty magazine is a failure
+    auto slab = std::unique_ptr<storage[]>( new (std::nothrow) storage[m_slab_size] );
+    if( slab == nullptr ) {
+      if( m.count == 0 ) throw std::bad_alloc();
+      return;
+    }
+    m_slabs.push_back( std::move(slab) );
+    m_unused     = m_slabs.back().get();
+    m_unused_end = m_unused + m_slab_size;
+  }
+
+  while( m.count != MagazineSize && m_unused != m_unused_end ) {
+    m.rounds[m.count++] = m_unused++;
+  }
+}
+
+template<typename T, std::size_t MagazineSize, std::size_t Slots>
+inline void bit::concurrency::object_pool<T,MagazineSize,Slots>
+  ::release( void* p )
+  noexcept
+{
+  std::lock_guard<spin_lock> lock(m_lock);
+
+  auto* object = ::new(p) free_object;
+  object->next = m_free;
+  m_free = object;
+}
+
+#endif /* BIT_CONCURRENCY_MEMORY_DETAIL_OBJECT_POOL_INL */
@@ -0,0 +1,311 @@
+/**
+ * \file record_registry.hpp
+ *
+ * \brief This header contains the registry of participant records, and the
+ *        bookkeeping of retired nodes, shared by the reclamation domains
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_MEMORY_DETAIL_RECORD_REGISTRY_HPP
+#define BIT_CONCURRENCY_MEMORY_DETAIL_RECORD_REGISTRY_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../../locks/spin_lock.hpp"
+
+#include "../../utilities/cache_aligned.hpp"
+
+#include <algorithm> // std::partition
+#include <atomic>    // std::atomic
+#include <cassert>
+#include <cstddef>   // std::size_t
+#include <iterator>  // std::make_move_iterator
+#include <mutex>     // std::lock_guard, std::unique_lock
+#include <utility>   // std::forward
+#include <vector>    // std::vector
+
+namespace bit {
+  namespace concurrency {
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief The per-thread records of a reclamation domain, and the
+      ///        nodes left behind by participants that have been destroyed
+      ///
+      /// Records are pushed onto a lock-free list, and are never freed
+      /// before the registry, so the list can be scanned without any
+      /// reclamation of its own. A record is reused by a later participant
+      /// once its owner releases it. Each record should derive from
+      /// cache_line_allocated, so that no two owners write to the same line.
+      ///
+      /// Nodes still retired when a record is released become orphans, and
+      /// are freed by later collections or by the registry's destructor.
+      ///
+      /// \tparam Record the record type. Must contain a
+      ///                \c std::atomic<bool> member named \c in_use, set
+      ///                on construction, a \c padded<Record*> member named
+      ///                \c next, and a \c std::vector<Node> member named
+      ///                \c retired
+      /// \tparam Node the retired node type. Must contain a \c void*
+      ///              member named \c pointer, and a \c void(*)(void*)
+      ///              member named \c deleter
+      ////////////////////////////////////////////////////////////////////////
+      template<typename Record, typename Node>
+      class record_registry
+      {
+        //--------------------------------------------------------------------
+        // Public Member Types
+        //--------------------------------------------------------------------
+      public:
+
+        using retired_list = std::vector<Node>;
+
+        //--------------------------------------------------------------------
+        // Constructors / Destructor / Assignment
+        //--------------------------------------------------------------------
+      public:
+
+        /// \brief Constructs an empty registry
+        record_registry() noexcept;
+
+        // Deleted copy constructor
+        record_registry( const record_registry& ) = delete;
+
+        //--------------------------------------------------------------------
+
+        /// \brief Deletes every record and every orphan
+        ///
+        /// Every record must have been released.
+        ~record_registry();
+
+        //--------------------------------------------------------------------
+
+        // Deleted copy assignment
+        record_registry& operator=( const record_registry& ) = delete;
+
+        //--------------------------------------------------------------------
+        // Records
+        //--------------------------------------------------------------------
+      public:
+
+        /// \brief Claims an unused record, or publishes a new one
+        ///
+        /// \param args the arguments to construct a new record from
+        /// \return the record
+        template<typename...Args>
+        Record* acquire( Args&&...args );
+
+        /// \brief Returns \p r to the registry, moving its retired nodes to
+        ///        the orphan list
+        ///
+        /// \param r the record
+        void release( Record* r );
+
+        /// \brief Gets the most recently published record
+        ///
+        /// \return the head of the list of records
+        Record* head() const noexcept;
+
+        /// \brief Gets the number of records that have been published
+        ///
+        /// \return the number of records
+        std::size_t size() const noexcept;
+
+        //--------------------------------------------------------------------
+        // Reclamation
+        //--------------------------------------------------------------------
+      public:
+
+        /// \brief Deletes the nodes retired by \p r, and those of the orphan
+        ///        list, that satisfy \p is_ready
+        ///
+        /// \param r the record to collect
+        /// \param is_ready a predicate over \c const Node&
+        template<typename Predicate>
+        void collect( Record* r, Predicate is_ready );
+
+        //--------------------------------------------------------------------
+        // Private Static Member Functions
+        //--------------------------------------------------------------------
+      private:
+
+        /// \brief Deletes the nodes of \p list that satisfy \p is_ready
+        template<typename Predicate>
+        static void sweep( retired_list& list, Predicate& is_ready );
+
+        //--------------------------------------------------------------------
+        // Private Members
+        //--------------------------------------------------------------------
+      private:
+
+        padded<std::atomic<Record*>>     m_records;
+        padded<std::atomic<std::size_t>> m_size;
+
+        spin_lock    m_orphan_lock;
+        retired_list m_orphans;
+      };
+
+    } // namespace detail
+  } // namespace concurrency
+} // namespace bit
+
+//============================================================================
+// Inline Definitions : record_registry
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors / Destructor
+//----------------------------------------------------------------------------
+
+template<typename Record, typename Node>
+inline bit::concurrency::detail::record_registry<Record,Node>::record_registry()
+  noexcept
+  : m_records(nullptr),
+    m_size(0),
+    m_orphan_lock(),
+    m_orphans()
+{
+
+}
+
+template<typename Record, typename Node>
+inline bit::concurrency::detail::record_registry<Record,Node>::~record_registry()
+{
+  auto* r = m_records->load(std::memory_order_acquire);
+
+  while( r != nullptr ) {
+    assert( !r->in_use.load(std::memory_order_relaxed) &&
+            "domain destroyed with live participants" );
+
+    auto* next = *r->next;
+    delete r;
+    r = next;
+  }
+
+  for( auto& node : m_orphans ) {
+    node.deleter( node.pointer );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Records
+//----------------------------------------------------------------------------
+
+template<typename Record, typename Node>
+template<typename...Args>
+inline Record* bit::concurrency::detail::record_registry<Record,Node>
+  ::acquire( Args&&...args )
+{
+  auto* head = m_records->load(std::memory_order_acquire);
+
+  for( auto* r = head; r != nullptr; r = *r->next ) {
+    auto expected = false;
+
+    if( !r->in_use.load(std::memory_order_relaxed) &&
+        r->in_use.compare_exchange_strong( expected, true,
+                                           std::memory_order_acquire,
+                                           std::memory_order_relaxed ) ) {
+      return r;
+    }
+  }
+
+  auto* r = new Record( std::forward<Args>(args)... );
+  *r->next = head;
+
+  while( !m_records->compare_exchange_weak( *r->next, r,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed ) ) {
+    // r->next is reloaded with the current head
+  }
+  m_size->fetch_add(1, std::memory_order_relaxed);
+
+  return r;
+}
+
+template<typename Record, typename Node>
+inline void bit::concurrency::detail::record_registry<Record,Node>
+  ::release( Record* r )
+{
+  if( !r->retired.empty() ) {
+    std::lock_guard<spin_lock> lock(m_orphan_lock);
+
+    m_orphans.insert( m_orphans.end(),
+                      r->retired.begin(),
+                      r->retired.end() );
+    r->retired.clear();
+  }
+
+  r->in_use.store(false, std::memory_order_release);
+}
+
+template<typename Record, typename Node>
+inline Record* bit::concurrency::detail::record_registry<Record,Node>::head()
+  const noexcept
+{
+  return m_records->load(std::memory_order_acquire);
+}
+
+template<typename Record, typename Node>
+inline std::size_t bit::concurrency::detail::record_registry<Record,Node>::size()
+  const noexcept
+{
+  return m_size->load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+// Reclamation
+//----------------------------------------------------------------------------
+
+template<typename Record, typename Node>
+template<typename Predicate>
+inline void bit::concurrency::detail::record_registry<Record,Node>
+  ::collect( Record* r, Predicate is_ready )
+{
+  sweep( r->retired, is_ready );
+
+  // Orphans are only freed opportunistically; a collection must not wait
+  // behind another
+  std::unique_lock<spin_lock> lock(m_orphan_lock, std::try_to_lock);
+
+  if( lock.owns_lock() && !m_orphans.empty() ) {
+    auto orphans = retired_list();
+    orphans.swap( m_orphans );
+    lock.unlock();
+
+    sweep( orphans, is_ready );
+
+    if( !orphans.empty() ) {
+      lock.lock();
+      orphans.insert( orphans.end(), m_orphans.begin(), m_orphans.end() );
+      m_orphans.swap( orphans );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Private Static Member Functions
+//----------------------------------------------------------------------------
+
+template<typename Record, typename Node>
+template<typename Predicate>
+inline void bit::concurrency::detail::record_registry<Record,Node>
+  ::sweep( retired_list& list, Predicate& is_ready )
+{
+  const auto last = std::partition( list.begin(), list.end(), is_ready );
+
+  if( last == list.begin() ) return;
+
+  // Deleters may retire further nodes, so the list must not be traversed
+  // while they run
+  auto ready = retired_list( std::make_move_iterator(list.begin()),
+                             std::make_move_iterator(last) );
+  list.erase( list.begin(), last );
+
+  for( auto& node : ready ) {
+    node.deleter( node.pointer );
+  }
+}
+
+#endif /* BIT_CONCURRENCY_MEMORY_DETAIL_RECORD_REGISTRY_HPP */
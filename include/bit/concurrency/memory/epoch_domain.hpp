@@ -0,0 +1,325 @@
+/**
+ * \file epoch_domain.hpp
+ *
+ * \brief This header contains an epoch-based memory reclamation domain
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_MEMORY_EPOCH_DOMAIN_HPP
+#define BIT_CONCURRENCY_MEMORY_EPOCH_DOMAIN_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/record_registry.hpp"
+
+#include "../utilities/cache_aligned.hpp"
+
+#include <atomic>  // std::atomic
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <vector>  // std::vector
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A domain for reclaiming memory that may still be read by
+    ///        lock-free readers
+    ///
+    /// Threads register with the domain as a \c participant, and bracket
+    /// every access to shared nodes with \c enter and \c exit (or a
+    /// \c guard). A node that has been unlinked is handed to \c retire
+    /// instead of being deleted; it is deleted only once the global epoch
+    /// has advanced twice past the epoch it was retired in, at which point
+    /// no critical region that could have observed it is still running.
+    ///
+    /// The epoch can only advance when every participant inside a critical
+    /// region has observed the current epoch, so readers pay only a store
+    /// and a fence on entry, and never write to shared state. Freeing is
+    /// batched: a participant attempts to advance and collect only once
+    /// every \c batch_size retirements.
+    ///
+    /// Nodes still pending when a participant is destroyed are moved to the
+    /// domain, and are freed by later collections or by the domain's
+    /// destructor.
+    //////////////////////////////////////////////////////////////////////////
+    class epoch_domain
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using deleter_type = void(*)(void*);
+
+      class participant;
+      class guard;
+
+      //----------------------------------------------------------------------
+      // Public Static Members
+      //----------------------------------------------------------------------
+    public:
+
+      static constexpr std::size_t default_batch_size = 64;
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an epoch_domain
+      ///
+      /// \param batch_size the number of retirements between collections
+      explicit epoch_domain( std::size_t batch_size = default_batch_size );
+
+      // Deleted copy constructor
+      epoch_domain( const epoch_domain& ) = delete;
+
+      // Deleted move constructor
+      epoch_domain( epoch_domain&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Destroys the domain, deleting every node still retired
+      ///
+      /// Every participant must have been destroyed before the domain.
+      ~epoch_domain();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      epoch_domain& operator=( const epoch_domain& ) = delete;
+
+      // Deleted move assignment
+      epoch_domain& operator=( epoch_domain&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Global Domain
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the process-wide domain, for containers that hide
+      ///        reclamation from their users
+      ///
+      /// \return the domain, constructed on first use
+      static epoch_domain& global();
+
+      /// \brief Gets the calling thread's participant in the global domain
+      ///
+      /// The participant is registered on first use, and unregistered when
+      /// the thread exits; every thread that uses it must have exited or
+      /// been joined before static destruction begins.
+      ///
+      /// \return the participant
+      static participant& this_thread_participant();
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      struct retired_node
+      {
+        void*         pointer;
+        deleter_type  deleter;
+        std::uint64_t epoch; ///< the epoch the node was retired in
+      };
+
+      /// \brief The per-thread state of a participant
+      struct record : detail::cache_line_allocated
+      {
+        record() noexcept;
+
+        /// The pinned epoch shifted left by one, with the low bit set while
+        /// the owner is inside a critical region
+        std::atomic<std::uint64_t> state;
+        std::atomic<bool>          in_use;
+
+        /// Immutable once the record is published. The padding keeps the
+        /// state above, which other threads read, off of the owner-private
+        /// state below
+        padded<record*>            next;
+
+        // Owner access only
+        std::size_t                nesting;
+        std::size_t                collect_at;
+        std::vector<retired_node>  retired;
+      };
+
+      using registry = detail::record_registry<record,retired_node>;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      padded<std::atomic<std::uint64_t>> m_epoch;
+      registry                           m_registry;
+      std::size_t                        m_batch_size;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Claims an unused record, or publishes a new one
+      record* acquire_record();
+
+      /// \brief Returns \p r to the domain, moving its pending nodes to the
+      ///        orphan list
+      void release_record( record* r );
+
+      /// \brief Advances the global epoch if every participant inside a
+      ///        critical region has observed it
+      void try_advance() noexcept;
+
+      /// \brief Advances the epoch if possible, and deletes the nodes of
+      ///        \p r and of the orphan list that are no longer reachable
+      void collect( record* r );
+
+      template<typename T>
+      static void delete_pointer( void* p );
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A thread's registration with an epoch_domain
+    ///
+    /// A participant must only be used by one thread at a time, and must not
+    /// outlive its domain.
+    //////////////////////////////////////////////////////////////////////////
+    class epoch_domain::participant
+    {
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Registers a participant with \p domain
+      ///
+      /// \param domain the domain to register with
+      explicit participant( epoch_domain& domain );
+
+      // Deleted copy constructor
+      participant( const participant& ) = delete;
+
+      // Deleted move constructor
+      participant( participant&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Unregisters this participant
+      ///
+      /// The participant must not be inside a critical region.
+      ~participant();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      participant& operator=( const participant& ) = delete;
+
+      // Deleted move assignment
+      participant& operator=( participant&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Critical Regions
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Enters a critical region
+      ///
+      /// Nodes reachable from shared state inside the region are not deleted
+      /// before the region is exited. Regions may nest.
+      void enter() noexcept;
+
+      /// \brief Exits the innermost critical region
+      void exit() noexcept;
+
+      /// \brief Returns whether this participant is inside a critical region
+      ///
+      /// \return \c true if inside a critical region
+      bool in_critical_region() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Reclamation
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Retires \p pointer, to be passed to \p deleter once no
+      ///        critical region can still observe it
+      ///
+      /// \p pointer must already be unreachable from shared state.
+      ///
+      /// \param pointer the node to retire
+      /// \param deleter the function that deletes the node
+      void retire( void* pointer, deleter_type deleter );
+
+      /// \brief Retires \p pointer, to be deleted with \c delete once no
+      ///        critical region can still observe it
+      ///
+      /// \param pointer the node to retire
+      template<typename T>
+      void retire( T* pointer );
+
+      /// \brief Attempts to advance the epoch, and deletes every retired
+      ///        node that is no longer reachable
+      void collect();
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      epoch_domain* m_domain;
+      record*       m_record;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A scoped critical region of an epoch_domain::participant
+    //////////////////////////////////////////////////////////////////////////
+    class epoch_domain::guard
+    {
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Enters a critical region of \p p
+      ///
+      /// \param p the participant
+      explicit guard( participant& p ) noexcept;
+
+      // Deleted copy constructor
+      guard( const guard& ) = delete;
+
+      // Deleted move constructor
+      guard( guard&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Exits the critical region
+      ~guard();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      guard& operator=( const guard& ) = delete;
+
+      // Deleted move assignment
+      guard& operator=( guard&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      participant& m_participant;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/epoch_domain.inl"
+
+#endif /* BIT_CONCURRENCY_MEMORY_EPOCH_DOMAIN_HPP */
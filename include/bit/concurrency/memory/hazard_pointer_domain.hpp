@@ -0,0 +1,295 @@
+/**
+ * \file hazard_pointer_domain.hpp
+ *
+ * \brief This header contains a hazard pointer memory reclamation domain
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_MEMORY_HAZARD_POINTER_DOMAIN_HPP
+#define BIT_CONCURRENCY_MEMORY_HAZARD_POINTER_DOMAIN_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/record_registry.hpp"
+
+#include "../utilities/cache_aligned.hpp"
+
+#include <atomic>  // std::atomic
+#include <cassert>
+#include <cstddef> // std::size_t
+#include <memory>  // std::unique_ptr
+#include <vector>  // std::vector
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A domain for reclaiming memory that may still be read by
+    ///        lock-free readers, with bounded memory overhead
+    ///
+    /// Each participant owns a fixed number of hazard slots. Before
+    /// dereferencing a shared node, a reader publishes the node's address in
+    /// one of its slots with \c protect. A node handed to \c retire is
+    /// deleted only once a scan finds it in no slot.
+    ///
+    /// Unlike an epoch_domain, a stalled reader can only hold back the nodes
+    /// it has protected: after any scan at most \c H retired nodes survive
+    /// across the whole domain, where \c H is the total number of hazard
+    /// slots. Scans are amortized over at least \c 2H retirements, so each
+    /// participant holds at most \c threshold + \c H retired nodes, and
+    /// memory overhead is bounded by the number of participants and
+    /// hazards.
+    //////////////////////////////////////////////////////////////////////////
+    class hazard_pointer_domain
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using deleter_type = void(*)(void*);
+
+      class participant;
+
+      //----------------------------------------------------------------------
+      // Public Static Members
+      //----------------------------------------------------------------------
+    public:
+
+      static constexpr std::size_t default_hazards = 2;
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a hazard_pointer_domain
+      ///
+      /// The scan threshold is raised to twice the total number of hazard
+      /// slots whenever it is smaller, so that every scan reclaims at least
+      /// half of the nodes it examines.
+      ///
+      /// \param hazards the number of hazard slots of each participant
+      /// \param threshold the minimum number of retirements between scans
+      explicit hazard_pointer_domain( std::size_t hazards = default_hazards,
+                                      std::size_t threshold = 0 );
+
+      // Deleted copy constructor
+      hazard_pointer_domain( const hazard_pointer_domain& ) = delete;
+
+      // Deleted move constructor
+      hazard_pointer_domain( hazard_pointer_domain&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Destroys the domain, deleting every node still retired
+      ///
+      /// Every participant must have been destroyed before the domain.
+      ~hazard_pointer_domain();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      hazard_pointer_domain& operator=( const hazard_pointer_domain& ) = delete;
+
+      // Deleted move assignment
+      hazard_pointer_domain& operator=( hazard_pointer_domain&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns the number of hazard slots of each participant
+      ///
+      /// \return the number of hazard slots
+      std::size_t hazards() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      struct retired_node
+      {
+        void*        pointer;
+        deleter_type deleter;
+      };
+
+      /// \brief Frees a block of hazard slots from allocate_cache_lines
+      struct hazard_deleter
+      {
+        void operator()( std::atomic<void*>* hazards ) const noexcept;
+      };
+
+      /// The published addresses, in a block of cache lines that no other
+      /// record shares
+      using hazard_array = std::unique_ptr<std::atomic<void*>[],hazard_deleter>;
+
+      /// \brief The per-thread state of a participant
+      struct record : detail::cache_line_allocated
+      {
+        explicit record( std::size_t hazards );
+
+        hazard_array              hazards; ///< the published addresses
+        std::atomic<bool>         in_use;
+
+        /// Immutable once the record is published. The padding keeps the
+        /// state above, which other threads read, off of the owner-private
+        /// state below
+        padded<record*>           next;
+
+        // Owner access only
+        std::size_t               collect_at;
+        std::vector<retired_node> retired;
+      };
+
+      using registry = detail::record_registry<record,retired_node>;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      registry    m_registry;
+      std::size_t m_hazards;
+      std::size_t m_threshold;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Claims an unused record, or publishes a new one
+      record* acquire_record();
+
+      /// \brief Returns \p r to the domain, moving its pending nodes to the
+      ///        orphan list
+      void release_record( record* r );
+
+      /// \brief Returns the number of retirements between scans, given the
+      ///        current number of participants
+      std::size_t threshold() const noexcept;
+
+      /// \brief Scans the hazard slots, and deletes the nodes of \p r and of
+      ///        the orphan list that are not protected
+      void collect( record* r );
+
+      template<typename T>
+      static void delete_pointer( void* p );
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A thread's registration with a hazard_pointer_domain
+    ///
+    /// A participant must only be used by one thread at a time, and must not
+    /// outlive its domain.
+    //////////////////////////////////////////////////////////////////////////
+    class hazard_pointer_domain::participant
+    {
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Registers a participant with \p domain
+      ///
+      /// \param domain the domain to register with
+      explicit participant( hazard_pointer_domain& domain );
+
+      // Deleted copy constructor
+      participant( const participant& ) = delete;
+
+      // Deleted move constructor
+      participant( participant&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Clears every hazard slot and unregisters this participant
+      ~participant();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      participant& operator=( const participant& ) = delete;
+
+      // Deleted move assignment
+      participant& operator=( participant&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Protection
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Loads \p source and protects the loaded node in the hazard
+      ///        slot \p index
+      ///
+      /// The node stays safe to dereference until the slot is cleared or
+      /// reused. Any node previously protected by the slot is released.
+      ///
+      /// \param index the hazard slot to use
+      /// \param source the shared pointer to load
+      /// \return the protected node, which may be \c nullptr
+      template<typename T>
+      T* protect( std::size_t index, const std::atomic<T*>& source ) noexcept;
+
+      /// \brief Publishes \p pointer in the hazard slot \p index without
+      ///        validating it
+      ///
+      /// The caller must re-check that \p pointer is still reachable after
+      /// this call before dereferencing it.
+      ///
+      /// \param index the hazard slot to use
+      /// \param pointer the node to protect
+      void set( std::size_t index, void* pointer ) noexcept;
+
+      /// \brief Clears the hazard slot \p index
+      ///
+      /// \param index the hazard slot to clear
+      void clear( std::size_t index ) noexcept;
+
+      /// \brief Clears every hazard slot
+      void clear() noexcept;
+
+      //----------------------------------------------------------------------
+      // Reclamation
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Retires \p pointer, to be passed to \p deleter once no hazard
+      ///        slot protects it
+      ///
+      /// \p pointer must already be unreachable from shared state.
+      ///
+      /// \param pointer the node to retire
+      /// \param deleter the function that deletes the node
+      void retire( void* pointer, deleter_type deleter );
+
+      /// \brief Retires \p pointer, to be deleted with \c delete once no
+      ///        hazard slot protects it
+      ///
+      /// \param pointer the node to retire
+      template<typename T>
+      void retire( T* pointer );
+
+      /// \brief Scans the hazard slots, and deletes every retired node that
+      ///        is not protected
+      void collect();
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      hazard_pointer_domain* m_domain;
+      record*                m_record;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/hazard_pointer_domain.inl"
+
+#endif /* BIT_CONCURRENCY_MEMORY_HAZARD_POINTER_DOMAIN_HPP */
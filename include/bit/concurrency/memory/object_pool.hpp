@@ -0,0 +1,262 @@
+/**
+ * \file object_pool.hpp
+ *
+ * \brief This header contains a pool of fixed-size objects with per-thread
+ *        magazine caches
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_MEMORY_OBJECT_POOL_HPP
+#define BIT_CONCURRENCY_MEMORY_OBJECT_POOL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../locks/spin_lock.hpp"
+
+#include "../utilities/cache_aligned.hpp"
+#include "../utilities/per_thread.hpp"
+
+#include <atomic>      // std::atomic
+#include <cstddef>     // std::size_t, std::max_align_t
+#include <cstdint>     // std::uint32_t, std::uint64_t
+#include <memory>      // std::unique_ptr
+#include <type_traits> // std::aligned_storage
+#include <vector>      // std::vector
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A pool of storage for objects of type \p T, for nodes that are
+    ///        allocated on one thread and freed on another
+    ///
+    /// The pool is layered in the manner of Bonwick's magazine allocator.
+    /// Each thread caches two magazines, arrays of up to \p MagazineSize
+    /// free objects, and allocates from and frees to them without touching
+    /// shared state. Only when both are exhausted, or both are full, does a
+    /// thread trade a whole magazine with the depot, so objects move between
+    /// threads in batches: a consumer that frees a producer's nodes hands
+    /// them back a magazine at a time.
+    ///
+    /// The depot is a pair of lock-free stacks, of full and of empty
+    /// magazines. Magazines are addressed by index and never freed before
+    /// the pool, and each stack's head packs an index with a tag that
+    /// every update increments, so a single 64-bit compare-and-swap is safe
+    /// from ABA. Only when the depot has no full magazine is the slab layer
+    /// locked, to refill a magazine from freed objects or from a new slab.
+    ///
+    /// The thread caches are a per_thread of \p Slots entries, each with a
+    /// lock that is uncontended unless more than \p Slots threads use the
+    /// pool at once.
+    ///
+    /// Destroying the pool releases every slab, whether or not its objects
+    /// were returned; objects still in use are not destroyed.
+    ///
+    /// \tparam T the type of object
+    /// \tparam MagazineSize the number of objects in a magazine
+    /// \tparam Slots the number of thread caches
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T, std::size_t MagazineSize = 32, std::size_t Slots = 64>
+    class object_pool
+    {
+      static_assert( MagazineSize > 0, "object_pool requires non-empty magazines" );
+      static_assert( alignof(T) <= alignof(std::max_align_t),
+                     "object_pool does not support over-aligned types" );
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+      using size_type  = std::size_t;
+
+      //----------------------------------------------------------------------
+      // Public Static Members
+      //----------------------------------------------------------------------
+    public:
+
+      static constexpr size_type default_slab_size = 256;
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty object_pool
+      ///
+      /// \param slab_size the number of objects allocated at once when the
+      ///        pool has none free
+      explicit object_pool( size_type slab_size = default_slab_size );
+
+      // Deleted copy constructor
+      object_pool( const object_pool& ) = delete;
+
+      // Deleted move constructor
+      object_pool( object_pool&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Releases every slab and magazine
+      ///
+      /// No other thread may be using the pool.
+      ~object_pool();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      object_pool& operator=( const object_pool& ) = delete;
+
+      // Deleted move assignment
+      object_pool& operator=( object_pool&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Allocation
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Allocates uninitialized storage for one \p T
+      ///
+      /// \throw std::bad_alloc if no storage is free and no slab can be
+      ///        allocated
+      /// \return the storage
+      void* allocate();
+
+      /// \brief Returns storage obtained from allocate() to the pool
+      ///
+      /// Any thread may return storage, not only the one that allocated it.
+      ///
+      /// \param p the storage
+      void deallocate( void* p ) noexcept;
+
+      /// \brief Allocates and constructs a \p T from \p args
+      ///
+      /// \param args the arguments to forward to the constructor
+      /// \return the object
+      template<typename...Args>
+      T* construct( Args&&...args );
+
+      /// \brief Destroys \p p, and returns its storage to the pool
+      ///
+      /// \param p an object obtained from construct()
+      void destroy( T* p ) noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      using storage = typename std::aligned_storage<
+        (sizeof(T) < sizeof(void*) ? sizeof(void*) : sizeof(T)),
+        (alignof(T) < alignof(void*) ? alignof(void*) : alignof(T))
+      >::type;
+
+      /// \brief A free object of the slab layer
+      struct free_object
+      {
+        free_object* next;
+      };
+
+      struct magazine
+      {
+        void*                      rounds[MagazineSize];
+        size_type                  count = 0;
+        std::uint32_t              index = 0;
+        std::atomic<std::uint32_t> next{0}; ///< the next in a depot stack, plus one
+      };
+
+      /// \brief A thread's pair of magazines
+      ///
+      /// Each is null or a magazine of the thread's own; 'previous' is
+      /// always empty or full.
+      struct cache
+      {
+        spin_lock lock;
+        magazine* loaded   = nullptr;
+        magazine* previous = nullptr;
+      };
+
+      /// A depot stack's head: a tag in the high half, and the index of
+      /// the top magazine plus one, or zero, in the low half
+      using stack_head = std::atomic<std::uint64_t>;
+
+      //----------------------------------------------------------------------
+      // Private Static Members
+      //----------------------------------------------------------------------
+    private:
+
+      /// The number of magazines in the first block; each later block
+      /// doubles it
+      static constexpr size_type first_block_size = 16;
+
+      static constexpr size_type max_blocks = 24;
+
+      /// Published blocks of magazines, indexed by block number
+      using block_array = std::atomic<magazine*>[max_blocks];
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      padded<stack_head> m_full;
+      padded<stack_head> m_empty;
+
+      /// Read without locking by the depot; the padding keeps the slab
+      /// layer's writes off of its lines
+      padded<block_array> m_blocks;
+
+      // The slab layer; every member below is guarded by 'm_lock'
+      spin_lock m_lock;
+      std::vector<std::unique_ptr<storage[]>> m_slabs;
+      storage*     m_unused;      ///< the first object never handed out
+      storage*     m_unused_end;
+      free_object* m_free;        ///< objects freed past the magazines
+      size_type    m_slab_size;
+      size_type    m_magazines;   ///< the number of magazines created
+
+      per_thread<cache,Slots> m_caches;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Pushes \p m onto \p stack
+      void push( stack_head& stack, magazine* m ) noexcept;
+
+      /// \brief Pops a magazine from \p stack
+      ///
+      /// \return the magazine, or null if \p stack is empty
+      magazine* pop( stack_head& stack ) noexcept;
+
+      /// \brief Gets the magazine with index \p index
+      magazine* magazine_at( std::uint32_t index ) const noexcept;
+
+      /// \brief Creates an empty magazine
+      ///
+      /// \return the magazine, or null if one cannot be allocated
+      magazine* make_magazine() noexcept;
+
+      /// \brief Gets an empty magazine from the depot, or creates one
+      ///
+      /// \return the magazine, or null if one cannot be allocated
+      magazine* empty_magazine() noexcept;
+
+      /// \brief Fills \p m from the slab layer, allocating a slab if needed
+      ///
+      /// \throw std::bad_alloc if \p m is still empty
+      void refill( magazine& m );
+
+      /// \brief Returns \p p directly to the slab layer
+      void release( void* p ) noexcept;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/object_pool.inl"
+
+#endif /* BIT_CONCURRENCY_MEMORY_OBJECT_POOL_HPP */
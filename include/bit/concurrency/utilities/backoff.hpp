@@ -0,0 +1,156 @@
+/**
+ * \file backoff.hpp
+ *
+ * \brief This header contains the busy-wait backoff policies used by the
+ *        spinning primitives
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_UTILITIES_BACKOFF_HPP
+#define BIT_CONCURRENCY_UTILITIES_BACKOFF_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <atomic>  // std::atomic_signal_fence
+#include <cstddef> // std::size_t
+#include <thread>  // std::this_thread::yield
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+# include <emmintrin.h> // _mm_pause
+#endif
+
+namespace bit {
+  namespace concurrency {
+
+    /// \brief Hints to the processor that the calling thread is in a
+    ///        busy-wait loop
+    ///
+    /// On x86 this emits the 'pause' instruction, and on ARM the 'yield'
+    /// instruction. This reduces the power spent spinning and avoids the
+    /// memory-order mis-speculation penalty when the spun-on cache line
+    /// finally changes. It never enters the operating system.
+    void cpu_relax() noexcept;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A backoff policy that issues a single cpu_relax() for every
+    ///        failed attempt
+    ///
+    /// A \c Backoff policy is a default-constructible type that is invoked
+    /// once per failed acquisition attempt. A fresh policy is constructed
+    /// for every contended acquisition.
+    //////////////////////////////////////////////////////////////////////////
+    class pause_backoff
+    {
+    public:
+
+      /// \brief Backs off after a failed attempt
+      void operator()() noexcept;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A backoff policy that yields the time-slice on every failed
+    ///        attempt
+    ///
+    /// This is only appropriate when the lock may be held across a
+    /// preemption, since each invocation is a system call.
+    //////////////////////////////////////////////////////////////////////////
+    class yield_backoff
+    {
+    public:
+
+      /// \brief Backs off after a failed attempt
+      void operator()() noexcept;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A backoff policy that spins \p Spins times before yielding
+    ///        on each subsequent failed attempt
+    ///
+    /// \tparam Spins the number of attempts to spin before yielding
+    //////////////////////////////////////////////////////////////////////////
+    template<std::size_t Spins = 64>
+    class spin_then_yield_backoff
+    {
+      //----------------------------------------------------------------------
+      // Constructor
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Default-constructs this spin_then_yield_backoff
+      spin_then_yield_backoff() noexcept;
+
+      //----------------------------------------------------------------------
+      // Backoff
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Backs off after a failed attempt
+      void operator()() noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::size_t m_spins; ///< the number of attempts spun so far
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A backoff policy that doubles the number of cpu_relax() calls
+    ///        on each failed attempt, up to \p MaxPauses
+    ///
+    /// Once the upper bound has been reached, each further attempt yields
+    /// the time-slice so that a preempted lock-holder is able to make
+    /// progress on an oversubscribed system.
+    ///
+    /// \tparam MinPauses the number of pauses for the first failed attempt
+    /// \tparam MaxPauses the upper bound on the pauses for a single attempt
+    //////////////////////////////////////////////////////////////////////////
+    template<std::size_t MinPauses = 1, std::size_t MaxPauses = 1024>
+    class exponential_backoff
+    {
+      static_assert( MinPauses > 0, "MinPauses must be non-zero" );
+      static_assert( MinPauses <= MaxPauses, "MinPauses cannot exceed MaxPauses" );
+
+      //----------------------------------------------------------------------
+      // Constructor
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Default-constructs this exponential_backoff
+      exponential_backoff() noexcept;
+
+      //----------------------------------------------------------------------
+      // Backoff
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Backs off after a failed attempt
+      void operator()() noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns the number of pauses the next attempt will issue
+      ///
+      /// \return the number of pauses, or \c 0 once attempts yield instead
+      std::size_t pauses() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::size_t m_pauses; ///< the number of pauses for the next attempt
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/backoff.inl"
+
+#endif /* BIT_CONCURRENCY_UTILITIES_BACKOFF_HPP */
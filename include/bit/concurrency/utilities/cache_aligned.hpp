@@ -0,0 +1,231 @@
+/**
+ * \file cache_aligned.hpp
+ *
+ * \brief This header contains wrappers that keep a value off the cache lines
+ *        of its neighbours
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_UTILITIES_CACHE_ALIGNED_HPP
+#define BIT_CONCURRENCY_UTILITIES_CACHE_ALIGNED_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "cache_line.hpp"
+
+#include <cstddef>     // std::size_t, std::max_align_t
+#include <new>         // operator new, operator delete
+#include <type_traits> // std::enable_if_t, std::is_constructible
+#include <utility>     // std::forward
+
+namespace bit {
+  namespace concurrency {
+    namespace detail {
+
+      /// \brief The bytes needed to round \c T up to a whole number of
+      ///        cache lines
+      template<typename T>
+      constexpr std::size_t cache_line_padding()
+      {
+        return (cache_line_size - sizeof(T) % cache_line_size) % cache_line_size;
+      }
+
+      /// \brief Storage for a value followed by \p Padding bytes
+      template<typename T, std::size_t Padding = cache_line_padding<T>()>
+      struct padded_storage
+      {
+        template<typename...Args>
+        constexpr explicit padded_storage( Args&&...args )
+          : value(std::forward<Args>(args)...), padding(){}
+
+        T    value;
+        char padding[Padding];
+      };
+
+      template<typename T>
+      struct padded_storage<T,0>
+      {
+        template<typename...Args>
+        constexpr explicit padded_storage( Args&&...args )
+          : value(std::forward<Args>(args)...){}
+
+        T value;
+      };
+
+      /// \brief Allocates \p size bytes, rounded up to whole cache lines,
+      ///        beginning on a cache line
+      ///
+      /// Before C++17, plain 'new' does not honour alignment beyond that of
+      /// std::max_align_t, so this over-allocates and stores the address of
+      /// the block just ahead of the lines it returns.
+      ///
+      /// \param size the number of bytes
+      /// \return the first byte
+      void* allocate_cache_lines( std::size_t size );
+
+      /// \brief Deallocates storage from allocate_cache_lines
+      ///
+      /// \param p the storage, or \c nullptr
+      void deallocate_cache_lines( void* p ) noexcept;
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A base that gives a class 'new' and 'delete' operators that
+      ///        place each object on cache lines of its own
+      ///
+      /// The operators are found ahead of the global ones in every standard,
+      /// so a heap-allocated derived class is line-aligned even where
+      /// the global operators ignore over-alignment.
+      ///
+      /// This is what lets a queue lock's waiter spin on its own node: no
+      /// other node shares the line, so nobody writes to it until the
+      /// lock is handed over.
+      ////////////////////////////////////////////////////////////////////////
+      struct cache_line_allocated
+      {
+        static void* operator new( std::size_t size );
+        static void* operator new[]( std::size_t size );
+
+        static void operator delete( void* p ) noexcept;
+        static void operator delete[]( void* p ) noexcept;
+      };
+
+    } // namespace detail
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A \c T that begins on a cache line, and has one to itself
+    ///
+    /// This is for values that must not share a line with anything else,
+    /// such as a standalone lock or a block allocated for one thread.
+    /// Allocating one with 'new' places it on lines of its own in any
+    /// standard; a class that merely contains one is over-aligned, though,
+    /// and before C++17 plain 'new' of that class ignores the alignment.
+    /// The primitives in this library therefore keep their hot members
+    /// apart with padded, and leave the placement of the whole object to
+    /// the caller.
+    ///
+    /// \tparam T the type of the value
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class alignas(cache_line_size) cache_aligned
+      : public detail::cache_line_allocated
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Value-initializes the \c T
+      constexpr cache_aligned();
+
+      /// \brief Constructs the \c T from \p args
+      ///
+      /// \param args the arguments to forward to \c T's constructor
+      template<typename...Args,
+               typename = std::enable_if_t<std::is_constructible<T,Args...>::value>>
+      constexpr explicit cache_aligned( Args&&...args );
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the underlying value
+      ///
+      /// \return the value
+      T& get() noexcept;
+      const T& get() const noexcept;
+
+      T& operator*() noexcept;
+      const T& operator*() const noexcept;
+
+      T* operator->() noexcept;
+      const T* operator->() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      T m_value;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A \c T followed by enough bytes to fill out its last cache line
+    ///
+    /// Unlike cache_aligned, padded is not over-aligned, so a class with
+    /// padded members can be allocated with plain 'new' in any standard.
+    /// It separates the members from each other, and from whatever follows
+    /// the class, but not from whatever precedes it.
+    ///
+    /// The elements of an array of padded values are each a whole number of
+    /// lines apart, so when the array begins on a line no two elements share
+    /// one; when it does not, only a \c T that straddles a line boundary can
+    /// share a line with its neighbour.
+    ///
+    /// \tparam T the type of the value
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T>
+    class padded
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = T;
+
+      //----------------------------------------------------------------------
+      // Constructors
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Value-initializes the \c T
+      constexpr padded();
+
+      /// \brief Constructs the \c T from \p args
+      ///
+      /// \param args the arguments to forward to \c T's constructor
+      template<typename...Args,
+               typename = std::enable_if_t<std::is_constructible<T,Args...>::value>>
+      constexpr explicit padded( Args&&...args );
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the underlying value
+      ///
+      /// \return the value
+      T& get() noexcept;
+      const T& get() const noexcept;
+
+      T& operator*() noexcept;
+      const T& operator*() const noexcept;
+
+      T* operator->() noexcept;
+      const T* operator->() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      detail::padded_storage<T> m_storage;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/cache_aligned.inl"
+
+#endif /* BIT_CONCURRENCY_UTILITIES_CACHE_ALIGNED_HPP */
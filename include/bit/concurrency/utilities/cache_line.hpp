@@ -0,0 +1,36 @@
+/**
+ * \file cache_line.hpp
+ *
+ * \brief This header defines the cache line size assumed when separating
+ *        independently-written data
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_UTILITIES_CACHE_LINE_HPP
+#define BIT_CONCURRENCY_UTILITIES_CACHE_LINE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <cstddef> // std::size_t
+
+namespace bit {
+  namespace concurrency {
+
+    /// \brief The size, in bytes, used to keep independently-written data on
+    ///        separate cache lines
+    ///
+    /// This is deliberately a fixed constant rather than
+    /// std::hardware_destructive_interference_size so that the layout of
+    /// types in this library does not change with compiler flags.
+#if (defined(__APPLE__) && defined(__aarch64__)) || defined(__powerpc64__)
+    constexpr std::size_t cache_line_size = 128;
+#else
+    constexpr std::size_t cache_line_size = 64;
+#endif
+
+  } // namespace concurrency
+} // namespace bit
+
+#endif /* BIT_CONCURRENCY_UTILITIES_CACHE_LINE_HPP */
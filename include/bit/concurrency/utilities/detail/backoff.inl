@@ -0,0 +1,124 @@
+#ifndef BIT_CONCURRENCY_UTILITIES_DETAIL_BACKOFF_INL
+#define BIT_CONCURRENCY_UTILITIES_DETAIL_BACKOFF_INL
+
+//============================================================================
+// Inline Definitions : cpu_relax
+//============================================================================
+
+inline void bit::concurrency::cpu_relax()
+  noexcept
+{
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+  _mm_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+  __builtin_ia32_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__arm__) || defined(__aarch64__))
+  __asm__ __volatile__("yield" ::: "memory");
+#else
+  // Prevent the compiler from collapsing the surrounding loop.
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+//============================================================================
+// Inline Definitions : pause_backoff
+//============================================================================
+
+inline void bit::concurrency::pause_backoff::operator()()
+  noexcept
+{
+  cpu_relax();
+}
+
+//============================================================================
+// Inline Definitions : yield_backoff
+//============================================================================
+
+inline void bit::concurrency::yield_backoff::operator()()
+  noexcept
+{
+  std::this_thread::yield();
+}
+
+//============================================================================
+// Inline Definitions : spin_then_yield_backoff
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+template<std::size_t Spins>
+inline bit::concurrency::spin_then_yield_backoff<Spins>::spin_then_yield_backoff()
+  noexcept
+  : m_spins(0)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Backoff
+//----------------------------------------------------------------------------
+
+template<std::size_t Spins>
+inline void bit::concurrency::spin_then_yield_backoff<Spins>::operator()()
+  noexcept
+{
+  if( m_spins < Spins ) {
+    ++m_spins;
+    cpu_relax();
+  } else {
+    std::this_thread::yield();
+  }
+}
+
+//============================================================================
+// Inline Definitions : exponential_backoff
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+template<std::size_t MinPauses, std::size_t MaxPauses>
+inline bit::concurrency::exponential_backoff<MinPauses,MaxPauses>
+  ::exponential_backoff()
+  noexcept
+  : m_pauses(MinPauses)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Backoff
+//----------------------------------------------------------------------------
+
+template<std::size_t MinPauses, std::size_t MaxPauses>
+inline void bit::concurrency::exponential_backoff<MinPauses,MaxPauses>
+  ::operator()()
+  noexcept
+{
+  if( m_pauses > MaxPauses ) {
+    std::this_thread::yield();
+    return;
+  }
+
+  for( auto i = std::size_t(0); i < m_pauses; ++i ) {
+    cpu_relax();
+  }
+  m_pauses *= 2;
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+template<std::size_t MinPauses, std::size_t MaxPauses>
+inline std::size_t bit::concurrency::exponential_backoff<MinPauses,MaxPauses>
+  ::pauses()
+  const noexcept
+{
+  return m_pauses > MaxPauses ? 0 : m_pauses;
+}
+
+#endif /* BIT_CONCURRENCY_UTILITIES_DETAIL_BACKOFF_INL */
@@ -0,0 +1,206 @@
+#ifndef BIT_CONCURRENCY_UTILITIES_DETAIL_CACHE_ALIGNED_INL
+#define BIT_CONCURRENCY_UTILITIES_DETAIL_CACHE_ALIGNED_INL
+
+#include <cstdint> // std::uintptr_t
+#include <cstring> // std::memcpy
+
+//============================================================================
+// Line Allocation
+//============================================================================
+
+inline void* bit::concurrency::detail::allocate_cache_lines( std::size_t size )
+{
+  static_assert( alignof(std::max_align_t) >= sizeof(void*),
+                 "the block address must fit ahead of the first line" );
+
+  const auto lines = (size + cache_line_size - 1) / cache_line_size;
+
+  // One extra line leaves room to align, and to store the block address
+  auto* block  = static_cast<unsigned char*>(
+    ::operator new( (lines + 1) * cache_line_size )
+  );
+  auto* result = block + cache_line_size
+               - reinterpret_cast<std::uintptr_t>(block) % cache_line_size;
+
+  std::memcpy( result - sizeof(void*), &block, sizeof(void*) );
+  return result;
+}
+
+inline void bit::concurrency::detail::deallocate_cache_lines( void* p )
+  noexcept
+{
+  if( p == nullptr ) return;
+
+  auto* block = static_cast<void*>(nullptr);
+  std::memcpy( &block, static_cast<unsigned char*>(p) - sizeof(void*), sizeof(void*) );
+
+  ::operator delete( block );
+}
+
+//----------------------------------------------------------------------------
+
+inline void* bit::concurrency::detail::cache_line_allocated
+  ::operator new( std::size_t size )
+{
+  return allocate_cache_lines( size );
+}
+
+inline void* bit::concurrency::detail::cache_line_allocated
+  ::operator new[]( std::size_t size )
+{
+  return allocate_cache_lines( size );
+}
+
+inline void bit::concurrency::detail::cache_line_allocated
+  ::operator delete( void* p )
+  noexcept
+{
+  deallocate_cache_lines( p );
+}
+
+inline void bit::concurrency::detail::cache_line_allocated
+  ::operator delete[]( void* p )
+  noexcept
+{
+  deallocate_cache_lines( p );
+}
+
+//============================================================================
+// cache_aligned<T>
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline constexpr bit::concurrency::cache_aligned<T>::cache_aligned()
+  : m_value()
+{
+
+}
+
+template<typename T>
+template<typename...Args, typename>
+inline constexpr bit::concurrency::cache_aligned<T>::cache_aligned( Args&&...args )
+  : m_value(std::forward<Args>(args)...)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline T& bit::concurrency::cache_aligned<T>::get()
+  noexcept
+{
+  return m_value;
+}
+
+template<typename T>
+inline const T& bit::concurrency::cache_aligned<T>::get()
+  const noexcept
+{
+  return m_value;
+}
+
+template<typename T>
+inline T& bit::concurrency::cache_aligned<T>::operator*()
+  noexcept
+{
+  return m_value;
+}
+
+template<typename T>
+inline const T& bit::concurrency::cache_aligned<T>::operator*()
+  const noexcept
+{
+  return m_value;
+}
+
+template<typename T>
+inline T* bit::concurrency::cache_aligned<T>::operator->()
+  noexcept
+{
+  return &m_value;
+}
+
+template<typename T>
+inline const T* bit::concurrency::cache_aligned<T>::operator->()
+  const noexcept
+{
+  return &m_value;
+}
+
+//============================================================================
+// padded<T>
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline constexpr bit::concurrency::padded<T>::padded()
+  : m_storage()
+{
+
+}
+
+template<typename T>
+template<typename...Args, typename>
+inline constexpr bit::concurrency::padded<T>::padded( Args&&...args )
+  : m_storage(std::forward<Args>(args)...)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+template<typename T>
+inline T& bit::concurrency::padded<T>::get()
+  noexcept
+{
+  return m_storage.value;
+}
+
+template<typename T>
+inline const T& bit::concurrency::padded<T>::get()
+  const noexcept
+{
+  return m_storage.value;
+}
+
+template<typename T>
+inline T& bit::concurrency::padded<T>::operator*()
+  noexcept
+{
+  return m_storage.value;
+}
+
+template<typename T>
+inline const T& bit::concurrency::padded<T>::operator*()
+  const noexcept
+{
+  return m_storage.value;
+}
+
+template<typename T>
+inline T* bit::concurrency::padded<T>::operator->()
+  noexcept
+{
+  return &m_storage.value;
+}
+
+template<typename T>
+inline const T* bit::concurrency::padded<T>::operator->()
+  const noexcept
+{
+  return &m_storage.value;
+}
+
+#endif /* BIT_CONCURRENCY_UTILITIES_DETAIL_CACHE_ALIGNED_INL */
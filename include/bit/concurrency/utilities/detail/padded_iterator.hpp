@@ -0,0 +1,119 @@
+/**
+ * \file padded_iterator.hpp
+ *
+ * \brief This header contains an iterator over the values of an array of
+ *        padded values
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_UTILITIES_DETAIL_PADDED_ITERATOR_HPP
+#define BIT_CONCURRENCY_UTILITIES_DETAIL_PADDED_ITERATOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "../cache_aligned.hpp"
+
+#include <cstddef>     // std::ptrdiff_t
+#include <iterator>    // std::forward_iterator_tag
+#include <type_traits> // std::conditional_t, std::is_const, std::remove_const_t
+
+namespace bit {
+  namespace concurrency {
+    namespace detail {
+
+      ////////////////////////////////////////////////////////////////////////
+      /// \brief A forward iterator that visits the \c T inside each element
+      ///        of an array of padded<T>
+      ///
+      /// \tparam T the value type, const-qualified for a const iterator
+      ////////////////////////////////////////////////////////////////////////
+      template<typename T>
+      class padded_iterator
+      {
+        using element = std::conditional_t<
+          std::is_const<T>::value,
+          const padded<std::remove_const_t<T>>,
+          padded<T>
+        >;
+
+        //--------------------------------------------------------------------
+        // Public Member Types
+        //--------------------------------------------------------------------
+      public:
+
+        using value_type        = std::remove_const_t<T>;
+        using reference         = T&;
+        using pointer           = T*;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        //--------------------------------------------------------------------
+        // Constructors
+        //--------------------------------------------------------------------
+      public:
+
+        /// \brief Constructs an iterator at \p position
+        explicit padded_iterator( element* position ) noexcept
+          : m_element(position)
+        {
+
+        }
+
+        //--------------------------------------------------------------------
+        // Iteration
+        //--------------------------------------------------------------------
+      public:
+
+        reference operator*() const noexcept
+        {
+          return m_element->get();
+        }
+
+        pointer operator->() const noexcept
+        {
+          return &m_element->get();
+        }
+
+        padded_iterator& operator++() noexcept
+        {
+          ++m_element;
+          return (*this);
+        }
+
+        padded_iterator operator++(int) noexcept
+        {
+          auto copy = (*this);
+          ++m_element;
+          return copy;
+        }
+
+        //--------------------------------------------------------------------
+        // Comparison
+        //--------------------------------------------------------------------
+      public:
+
+        bool operator==( const padded_iterator& other ) const noexcept
+        {
+          return m_element == other.m_element;
+        }
+
+        bool operator!=( const padded_iterator& other ) const noexcept
+        {
+          return m_element != other.m_element;
+        }
+
+        //--------------------------------------------------------------------
+        // Private Members
+        //--------------------------------------------------------------------
+      private:
+
+        element* m_element;
+      };
+
+    } // namespace detail
+  } // namespace concurrency
+} // namespace bit
+
+#endif /* BIT_CONCURRENCY_UTILITIES_DETAIL_PADDED_ITERATOR_HPP */
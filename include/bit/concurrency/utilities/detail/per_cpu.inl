@@ -0,0 +1,14 @@
+#ifndef BIT_CONCURRENCY_UTILITIES_DETAIL_PER_CPU_INL
+#define BIT_CONCURRENCY_UTILITIES_DETAIL_PER_CPU_INL
+
+//----------------------------------------------------------------------------
+// Processor Index
+//----------------------------------------------------------------------------
+
+inline std::size_t bit::concurrency::cpu_index_policy::index()
+  noexcept
+{
+  return this_cpu_index();
+}
+
+#endif /* BIT_CONCURRENCY_UTILITIES_DETAIL_PER_CPU_INL */
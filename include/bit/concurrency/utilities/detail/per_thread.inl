@@ -0,0 +1,27 @@
+#ifndef BIT_CONCURRENCY_UTILITIES_DETAIL_PER_THREAD_INL
+#define BIT_CONCURRENCY_UTILITIES_DETAIL_PER_THREAD_INL
+
+#include <atomic> // std::atomic
+
+//----------------------------------------------------------------------------
+// Thread Index
+//----------------------------------------------------------------------------
+
+inline std::size_t bit::concurrency::this_thread_index()
+  noexcept
+{
+  static std::atomic<std::size_t> s_next_index(0);
+  thread_local const auto index = s_next_index.fetch_add(1, std::memory_order_relaxed);
+
+  return index;
+}
+
+//----------------------------------------------------------------------------
+
+inline std::size_t bit::concurrency::thread_index_policy::index()
+  noexcept
+{
+  return this_thread_index();
+}
+
+#endif /* BIT_CONCURRENCY_UTILITIES_DETAIL_PER_THREAD_INL */
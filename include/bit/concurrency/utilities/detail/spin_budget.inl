@@ -0,0 +1,65 @@
+#ifndef BIT_CONCURRENCY_UTILITIES_DETAIL_SPIN_BUDGET_INL
+#define BIT_CONCURRENCY_UTILITIES_DETAIL_SPIN_BUDGET_INL
+
+//----------------------------------------------------------------------------
+// Constructor
+//----------------------------------------------------------------------------
+
+inline constexpr bit::concurrency::spin_budget::spin_budget()
+  noexcept
+  : m_spins(initial_spins)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+inline int bit::concurrency::spin_budget::spins()
+  const noexcept
+{
+  return m_spins.load(std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+inline void bit::concurrency::spin_budget::acquired( int spins )
+  noexcept
+{
+  // Aim for twice the observed wait, so that a slightly longer wait next
+  // time still succeeds without parking
+  const auto target = (spins < (max_spins / 2)) ? (spins * 2) : max_spins;
+
+  adjust_toward( target < min_spins ? min_spins : target );
+}
+
+inline void bit::concurrency::spin_budget::parked()
+  noexcept
+{
+  adjust_toward( min_spins );
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+inline void bit::concurrency::spin_budget::adjust_toward( int target )
+  noexcept
+{
+  const auto current = m_spins.load(std::memory_order_relaxed);
+  auto next          = current + (target - current) / 8;
+
+  // Integer division stalls the last few steps; always make progress
+  if( next == current && current != target ) {
+    next += (target > current) ? 1 : -1;
+  }
+
+  if( next != current ) {
+    m_spins.store(next, std::memory_order_relaxed);
+  }
+}
+
+#endif /* BIT_CONCURRENCY_UTILITIES_DETAIL_SPIN_BUDGET_INL */
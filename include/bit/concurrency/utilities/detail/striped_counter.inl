@@ -0,0 +1,73 @@
+#ifndef BIT_CONCURRENCY_UTILITIES_DETAIL_STRIPED_COUNTER_INL
+#define BIT_CONCURRENCY_UTILITIES_DETAIL_STRIPED_COUNTER_INL
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+inline bit::concurrency::striped_counter::striped_counter()
+  noexcept
+  : striped_counter(0)
+{
+
+}
+
+inline bit::concurrency::striped_counter::striped_counter( value_type value )
+  noexcept
+  : m_cells(nullptr),
+    m_base(value)
+{
+
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+inline void bit::concurrency::striped_counter::add( value_type n )
+  noexcept
+{
+  // A failed compare-and-swap means another thread updated the same word at
+  // the same moment, which is the signal to spread out. The strong form is
+  // used so that a spurious failure does not grow the counter.
+  auto* array = m_cells.load(std::memory_order_acquire);
+
+  if( array == nullptr ) {
+    auto base = m_base->load(std::memory_order_relaxed);
+    if( m_base->compare_exchange_strong( base, base + n,
+                                         std::memory_order_relaxed,
+                                         std::memory_order_relaxed ) ) {
+      return;
+    }
+  } else {
+    auto& cell = array->cells[this_cpu_index() & array->mask].get();
+    auto value = cell.load(std::memory_order_relaxed);
+    if( cell.compare_exchange_strong( value, value + n,
+                                      std::memory_order_relaxed,
+                                      std::memory_order_relaxed ) ) {
+      return;
+    }
+  }
+
+  add_contended( n, array );
+}
+
+inline void bit::concurrency::striped_counter::sub( value_type n )
+  noexcept
+{
+  add( -n );
+}
+
+inline void bit::concurrency::striped_counter::increment()
+  noexcept
+{
+  add( 1 );
+}
+
+inline void bit::concurrency::striped_counter::decrement()
+  noexcept
+{
+  add( -1 );
+}
+
+#endif /* BIT_CONCURRENCY_UTILITIES_DETAIL_STRIPED_COUNTER_INL */
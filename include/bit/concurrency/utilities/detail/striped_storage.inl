@@ -0,0 +1,84 @@
+#ifndef BIT_CONCURRENCY_UTILITIES_DETAIL_STRIPED_STORAGE_INL
+#define BIT_CONCURRENCY_UTILITIES_DETAIL_STRIPED_STORAGE_INL
+
+//----------------------------------------------------------------------------
+// Element Access
+//----------------------------------------------------------------------------
+
+template<typename T, typename Index, std::size_t Slots>
+inline T& bit::concurrency::striped_storage<T,Index,Slots>::local()
+  noexcept
+{
+  return m_slots[Index::index() % Slots].get();
+}
+
+template<typename T, typename Index, std::size_t Slots>
+inline const T& bit::concurrency::striped_storage<T,Index,Slots>::local()
+  const noexcept
+{
+  return m_slots[Index::index() % Slots].get();
+}
+
+template<typename T, typename Index, std::size_t Slots>
+inline T& bit::concurrency::striped_storage<T,Index,Slots>::operator[]( size_type index )
+  noexcept
+{
+  return m_slots[index].get();
+}
+
+template<typename T, typename Index, std::size_t Slots>
+inline const T& bit::concurrency::striped_storage<T,Index,Slots>::operator[]( size_type index )
+  const noexcept
+{
+  return m_slots[index].get();
+}
+
+//----------------------------------------------------------------------------
+// Capacity
+//----------------------------------------------------------------------------
+
+template<typename T, typename Index, std::size_t Slots>
+inline constexpr typename bit::concurrency::striped_storage<T,Index,Slots>::size_type
+  bit::concurrency::striped_storage<T,Index,Slots>::size()
+  noexcept
+{
+  return Slots;
+}
+
+//----------------------------------------------------------------------------
+// Iterators
+//----------------------------------------------------------------------------
+
+template<typename T, typename Index, std::size_t Slots>
+inline typename bit::concurrency::striped_storage<T,Index,Slots>::iterator
+  bit::concurrency::striped_storage<T,Index,Slots>::begin()
+  noexcept
+{
+  return iterator{ m_slots };
+}
+
+template<typename T, typename Index, std::size_t Slots>
+inline typename bit::concurrency::striped_storage<T,Index,Slots>::iterator
+  bit::concurrency::striped_storage<T,Index,Slots>::end()
+  noexcept
+{
+  return iterator{ m_slots + Slots };
+}
+
+template<typename T, typename Index, std::size_t Slots>
+inline typename bit::concurrency::striped_storage<T,Index,Slots>::const_iterator
+  bit::concurrency::striped_storage<T,Index,Slots>::begin()
+  const noexcept
+{
+  return const_iterator{ m_slots };
+}
+
+template<typename T, typename Index, std::size_t Slots>
+inline typename bit::concurrency::striped_storage<T,Index,Slots>::const_iterator
+  bit::concurrency::striped_storage<T,Index,Slots>::end()
+  const noexcept
+{
+  return const_iterator{ m_slots + Slots };
+}
+
+#endif /* BIT_CONCURRENCY_UTILITIES_DETAIL_STRIPED_STORAGE_INL */
@@ -0,0 +1,68 @@
+/**
+ * \file per_cpu.hpp
+ *
+ * \brief This header contains storage striped across processors, so that
+ *        threads usually update values no other processor is writing
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_UTILITIES_PER_CPU_HPP
+#define BIT_CONCURRENCY_UTILITIES_PER_CPU_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "per_thread.hpp"
+#include "striped_storage.hpp"
+
+#include <cstddef> // std::size_t
+
+namespace bit {
+  namespace concurrency {
+
+    /// \brief Gets the number of the processor the calling thread is
+    ///        running on
+    ///
+    /// The thread may be moved to another processor at any time, so the
+    /// result is only a hint. Where the platform cannot say, this returns
+    /// this_thread_index() instead.
+    ///
+    /// \return the calling thread's current processor
+    std::size_t this_cpu_index() noexcept;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief The index policy that assigns slots by this_cpu_index()
+    //////////////////////////////////////////////////////////////////////////
+    struct cpu_index_policy
+    {
+      static std::size_t index() noexcept;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief \p Slots padded values, of which each processor is assigned
+    ///        one
+    ///
+    /// local() returns the value of the processor the calling thread is
+    /// running on, chosen by this_cpu_index(). Unlike per_thread, the
+    /// number of threads does not matter: however many there are, only
+    /// the ones sharing a processor share a value, and those rarely run at
+    /// the same moment. A thread can still migrate, or be preempted, while
+    /// using its value, so the values must be safe for concurrent access.
+    ///
+    /// The lookup costs a call to the platform, which on Linux is
+    /// sched_getcpu(); prefer per_thread when the threads are few and
+    /// long-lived.
+    ///
+    /// \tparam T the type of each value
+    /// \tparam Slots the number of values
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T, std::size_t Slots = 64>
+    using per_cpu = striped_storage<T,cpu_index_policy,Slots>;
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/per_cpu.inl"
+
+#endif /* BIT_CONCURRENCY_UTILITIES_PER_CPU_HPP */
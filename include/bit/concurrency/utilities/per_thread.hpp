@@ -0,0 +1,63 @@
+/**
+ * \file per_thread.hpp
+ *
+ * \brief This header contains storage striped across threads, so that
+ *        threads usually update values of their own
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_UTILITIES_PER_THREAD_HPP
+#define BIT_CONCURRENCY_UTILITIES_PER_THREAD_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "striped_storage.hpp"
+
+#include <cstddef> // std::size_t
+
+namespace bit {
+  namespace concurrency {
+
+    /// \brief Gets a small number identifying the calling thread
+    ///
+    /// Threads are numbered in the order they first call this, starting at
+    /// zero, so the first \c n threads to stripe over \c n slots each get a
+    /// slot to themselves. Numbers are not reused when threads exit.
+    ///
+    /// \return the calling thread's index
+    std::size_t this_thread_index() noexcept;
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief The index policy that assigns slots by this_thread_index()
+    //////////////////////////////////////////////////////////////////////////
+    struct thread_index_policy
+    {
+      static std::size_t index() noexcept;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief \p Slots padded values, of which each thread is assigned one
+    ///
+    /// local() returns the calling thread's value, chosen by
+    /// this_thread_index(); the lookup is a thread-local load and a modulo
+    /// by a constant. Up to \p Slots threads each have a value to
+    /// themselves, and further threads share, so the values must still be
+    /// safe for concurrent access.
+    ///
+    /// A thread's slot does not depend on the per_thread, so a thread that
+    /// shares a slot in one shares it in every other of the same size.
+    ///
+    /// \tparam T the type of each value
+    /// \tparam Slots the number of values
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T, std::size_t Slots = 64>
+    using per_thread = striped_storage<T,thread_index_policy,Slots>;
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/per_thread.inl"
+
+#endif /* BIT_CONCURRENCY_UTILITIES_PER_THREAD_HPP */
@@ -0,0 +1,115 @@
+/**
+ * \file spin_budget.hpp
+ *
+ * \brief This header contains a self-tuning bound on how long a primitive
+ *        spins before blocking
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_UTILITIES_SPIN_BUDGET_HPP
+#define BIT_CONCURRENCY_UTILITIES_SPIN_BUDGET_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <atomic> // std::atomic
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A per-instance estimate of how many spins are worth spending
+    ///        before parking in the kernel
+    ///
+    /// The estimate follows the recent acquisition history, in the manner
+    /// of glibc's adaptive mutex: an acquisition that succeeds after \c n
+    /// spins moves the budget toward \c 2n, whereas spinning that fails
+    /// to acquire moves the budget toward \c min_spins. On dedicated cores
+    /// with short critical sections, the budget settles just above the
+    /// typical wait; on oversubscribed hosts, where a holder is likely to
+    /// be descheduled, it collapses so that waiters park almost at once.
+    ///
+    /// Updates are deliberately racy relaxed stores; a lost update only
+    /// perturbs the heuristic, and is cheaper than a read-modify-write.
+    //////////////////////////////////////////////////////////////////////////
+    class spin_budget
+    {
+      //----------------------------------------------------------------------
+      // Public Static Members
+      //----------------------------------------------------------------------
+    public:
+
+      static constexpr int min_spins     = 8;    ///< the lower bound
+      static constexpr int max_spins     = 8192; ///< the upper bound
+      static constexpr int initial_spins = 256;  ///< the starting budget
+
+      //----------------------------------------------------------------------
+      // Constructors / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a spin_budget starting at \c initial_spins
+      constexpr spin_budget() noexcept;
+
+      // Deleted copy constructor
+      spin_budget( const spin_budget& ) = delete;
+
+      // Deleted move constructor
+      spin_budget( spin_budget&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      spin_budget& operator=( const spin_budget& ) = delete;
+
+      // Deleted move assignment
+      spin_budget& operator=( spin_budget&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the number of spins to attempt before parking
+      ///
+      /// \return the current budget
+      int spins() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Records that spinning acquired the resource after \p spins
+      ///        iterations
+      ///
+      /// \param spins the number of iterations spent spinning
+      void acquired( int spins ) noexcept;
+
+      /// \brief Records that the entire budget was spent without acquiring
+      ///        the resource, and the caller is about to park
+      void parked() noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      std::atomic<int> m_spins; ///< the current budget
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Moves the budget an eighth of the way toward \p target
+      void adjust_toward( int target ) noexcept;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/spin_budget.inl"
+
+#endif /* BIT_CONCURRENCY_UTILITIES_SPIN_BUDGET_HPP */
@@ -0,0 +1,200 @@
+/**
+ * \file striped_counter.hpp
+ *
+ * \brief This header contains a counter that spreads contended updates
+ *        across cache lines
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_UTILITIES_STRIPED_COUNTER_HPP
+#define BIT_CONCURRENCY_UTILITIES_STRIPED_COUNTER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "cache_aligned.hpp"
+#include "per_cpu.hpp"
+
+#include <atomic>  // std::atomic
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int64_t
+#include <memory>  // std::unique_ptr
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A counter for frequent concurrent updates and infrequent
+    ///        reads, in the manner of Java's LongAdder
+    ///
+    /// Updates start out as a relaxed compare-and-swap on a single base
+    /// value. The first time one fails, which means another thread updated
+    /// the counter at the same moment, the counter allocates padded cells,
+    /// and from then on each update goes to the cell of the processor the
+    /// caller is running on. Whenever an update to a cell collides again,
+    /// the number of cells doubles, up to the first power of two not less
+    /// than the number of hardware threads. A counter that is never
+    /// contended stays a single word, and one that is settles at about a
+    /// cell per processor.
+    ///
+    /// read() sums the base and every cell. It is not a snapshot: updates
+    /// that race with it may or may not be counted, but once updates stop,
+    /// it is exact.
+    ///
+    /// Replaced cell arrays are kept, and summed, until the counter is
+    /// destroyed, so an update that loaded an old array is never lost; the
+    /// doubling bounds them to as many cells again as the final array.
+    //////////////////////////////////////////////////////////////////////////
+    class striped_counter
+    {
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type = std::int64_t;
+
+      //----------------------------------------------------------------------
+      // Constructors / Destructor / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs a counter with the value 0
+      striped_counter() noexcept;
+
+      /// \brief Constructs a counter with the value \p value
+      ///
+      /// \param value the initial value
+      explicit striped_counter( value_type value ) noexcept;
+
+      // Deleted copy constructor
+      striped_counter( const striped_counter& ) = delete;
+
+      // Deleted move constructor
+      striped_counter( striped_counter&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      /// \brief Destroys this counter, and every cell it allocated
+      ~striped_counter();
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      striped_counter& operator=( const striped_counter& ) = delete;
+
+      // Deleted move assignment
+      striped_counter& operator=( striped_counter&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Modifiers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Adds \p n to the counter
+      ///
+      /// The update is relaxed; it orders nothing else.
+      ///
+      /// \param n the amount to add
+      void add( value_type n ) noexcept;
+
+      /// \brief Subtracts \p n from the counter
+      ///
+      /// \param n the amount to subtract
+      void sub( value_type n ) noexcept;
+
+      /// \brief Adds 1 to the counter
+      void increment() noexcept;
+
+      /// \brief Subtracts 1 from the counter
+      void decrement() noexcept;
+
+      /// \brief Sets the counter to 0
+      ///
+      /// Updates that race with this may or may not survive it.
+      void reset() noexcept;
+
+      //----------------------------------------------------------------------
+      // Observers
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Sums the counter
+      ///
+      /// \return the sum
+      value_type read() const noexcept;
+
+      /// \brief Sums the counter, setting it to 0
+      ///
+      /// Each part is exchanged with 0, so every update is counted by
+      /// exactly one call, which suits sampling a rate.
+      ///
+      /// \return the sum
+      value_type read_and_reset() noexcept;
+
+      /// \brief Returns the number of cells that updates are currently
+      ///        spread across
+      ///
+      /// \return the number of cells, or 0 if the counter is uncontended
+      std::size_t cells() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Member Types
+      //----------------------------------------------------------------------
+    private:
+
+      using cell = padded<std::atomic<value_type>>;
+
+      struct cell_array
+      {
+        cell_array( std::unique_ptr<cell[]> cells,
+                    std::size_t size,
+                    cell_array* previous ) noexcept;
+
+        std::unique_ptr<cell[]> cells;
+        std::size_t             mask;     ///< the size, less one
+        cell_array*             previous; ///< the array this replaced
+      };
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      // 'm_cells' usually shares the line of 'm_base', which is only
+      // written until the first contention; after that, the line is only
+      // read
+      std::atomic<cell_array*>         m_cells;
+      padded<std::atomic<value_type>> m_base;
+
+      //----------------------------------------------------------------------
+      // Private Member Functions
+      //----------------------------------------------------------------------
+    private:
+
+      /// \brief Adds \p n after an update to \p array collided
+      ///
+      /// \param array the cells that were loaded, or null for the base
+      void add_contended( value_type n, cell_array* array ) noexcept;
+
+      /// \brief Replaces \p array with one twice its size, unless
+      ///        another thread already has, or it is at its largest
+      ///
+      /// Threads that collide at the same moment may each allocate an
+      /// array; only one is installed, and the rest are freed.
+      ///
+      /// \return the current array, which is null only if \p array was
+      ///         and no cells could be allocated
+      cell_array* grow( cell_array* array ) noexcept;
+
+      /// \brief Returns the largest number of cells
+      static std::size_t max_cells() noexcept;
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/striped_counter.inl"
+
+#endif /* BIT_CONCURRENCY_UTILITIES_STRIPED_COUNTER_HPP */
@@ -0,0 +1,130 @@
+/**
+ * \file striped_storage.hpp
+ *
+ * \brief This header contains padded values striped across slots, of which
+ *        the calling thread is assigned one by an index policy
+ *
+ * \author Matthew Rodusek (matthew.rodusek@gmail.com)
+ */
+#ifndef BIT_CONCURRENCY_UTILITIES_STRIPED_STORAGE_HPP
+#define BIT_CONCURRENCY_UTILITIES_STRIPED_STORAGE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "cache_aligned.hpp"
+#include "detail/padded_iterator.hpp"
+
+#include <cstddef> // std::size_t
+
+namespace bit {
+  namespace concurrency {
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief \p Slots padded values, of which the calling thread is
+    ///        assigned one by \p Index
+    ///
+    /// local() returns the value at <tt>Index::index() % Slots</tt>. Threads
+    /// that map to the same slot share its value, so the values must still
+    /// be safe for concurrent access. Every value can be visited, for
+    /// instance to sum them, by iterating.
+    ///
+    /// This is the common implementation of per_thread and per_cpu, which
+    /// differ only in their index policy.
+    ///
+    /// \tparam T the type of each value
+    /// \tparam Index the index policy; a type with a static, noexcept
+    ///               \c index() function returning a \c std::size_t
+    /// \tparam Slots the number of values
+    //////////////////////////////////////////////////////////////////////////
+    template<typename T, typename Index, std::size_t Slots>
+    class striped_storage
+    {
+      static_assert( Slots > 0, "striped_storage requires at least one slot" );
+
+      //----------------------------------------------------------------------
+      // Public Member Types
+      //----------------------------------------------------------------------
+    public:
+
+      using value_type     = T;
+      using index_policy   = Index;
+      using size_type      = std::size_t;
+      using iterator       = detail::padded_iterator<T>;
+      using const_iterator = detail::padded_iterator<const T>;
+
+      //----------------------------------------------------------------------
+      // Constructors / Assignment
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Value-initializes every slot
+      striped_storage() = default;
+
+      // Deleted copy constructor
+      striped_storage( const striped_storage& ) = delete;
+
+      // Deleted move constructor
+      striped_storage( striped_storage&& ) = delete;
+
+      //----------------------------------------------------------------------
+
+      // Deleted copy assignment
+      striped_storage& operator=( const striped_storage& ) = delete;
+
+      // Deleted move assignment
+      striped_storage& operator=( striped_storage&& ) = delete;
+
+      //----------------------------------------------------------------------
+      // Element Access
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Gets the calling thread's value
+      ///
+      /// \return the value
+      T& local() noexcept;
+      const T& local() const noexcept;
+
+      /// \brief Gets the value at \p index
+      ///
+      /// \param index the slot, in [0, size())
+      /// \return the value
+      T& operator[]( size_type index ) noexcept;
+      const T& operator[]( size_type index ) const noexcept;
+
+      //----------------------------------------------------------------------
+      // Capacity
+      //----------------------------------------------------------------------
+    public:
+
+      /// \brief Returns the number of slots
+      ///
+      /// \return \p Slots
+      static constexpr size_type size() noexcept;
+
+      //----------------------------------------------------------------------
+      // Iterators
+      //----------------------------------------------------------------------
+    public:
+
+      iterator begin() noexcept;
+      iterator end() noexcept;
+      const_iterator begin() const noexcept;
+      const_iterator end() const noexcept;
+
+      //----------------------------------------------------------------------
+      // Private Members
+      //----------------------------------------------------------------------
+    private:
+
+      padded<T> m_slots[Slots];
+    };
+
+  } // namespace concurrency
+} // namespace bit
+
+#include "detail/striped_storage.inl"
+
+#endif /* BIT_CONCURRENCY_UTILITIES_STRIPED_STORAGE_HPP */
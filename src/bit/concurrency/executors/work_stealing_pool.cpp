@@ -0,0 +1,266 @@
+#include <bit/concurrency/executors/work_stealing_pool.hpp>
+
+#include <bit/concurrency/utilities/backoff.hpp>
+
+#include <cassert>
+
+namespace {
+
+  //--------------------------------------------------------------------------
+  // Task Node Cache
+  //--------------------------------------------------------------------------
+
+  /// The most nodes a thread keeps. Nodes are released by whichever thread
+  /// runs the task, so a thread that only runs work posted by others would
+  /// otherwise accumulate nodes without bound.
+  constexpr std::size_t max_cached_task_nodes = 256;
+
+  struct task_node_cache
+  {
+    task_node_cache() noexcept
+      : head(nullptr),
+        size(0)
+    {
+
+    }
+
+    ~task_node_cache()
+    {
+      while( head != nullptr ) {
+        auto* next = head->cache_next;
+        delete head;
+        head = next;
+      }
+    }
+
+    bit::concurrency::detail::task_node* head;
+    std::size_t                          size;
+  };
+
+  task_node_cache& local_task_node_cache() noexcept
+  {
+    thread_local task_node_cache cache;
+
+    return cache;
+  }
+
+  //--------------------------------------------------------------------------
+  // Worker Identity
+  //--------------------------------------------------------------------------
+
+  /// The pool that the calling thread is a worker of, if any
+  thread_local bit::concurrency::work_stealing_pool* t_pool = nullptr;
+
+  /// The index of the calling thread within t_pool
+  thread_local std::size_t t_index = 0;
+
+  /// Random state for threads outside the pool that steal
+  thread_local std::uint32_t t_random = 0x9e3779b9u;
+
+  /// \brief Advances the xorshift generator \p state
+  std::uint32_t next_random( std::uint32_t& state ) noexcept
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+
+  /// Polls for work this many times before a worker announces that it is
+  /// going to sleep
+  constexpr int idle_spins = 64;
+
+} // anonymous namespace
+
+//============================================================================
+// detail::task_node
+//============================================================================
+
+constexpr std::size_t bit::concurrency::detail::task_node::buffer_size;
+
+bit::concurrency::detail::task_node*
+  bit::concurrency::detail::acquire_task_node()
+{
+  auto& cache = local_task_node_cache();
+  auto* node  = cache.head;
+
+  if( node == nullptr ) {
+    return new task_node();
+  }
+  cache.head = node->cache_next;
+  --cache.size;
+  return node;
+}
+
+void bit::concurrency::detail::release_task_node( task_node* node )
+  noexcept
+{
+  auto& cache = local_task_node_cache();
+
+  if( cache.size == max_cached_task_nodes ) {
+    delete node;
+    return;
+  }
+  node->cache_next = cache.head;
+  cache.head = node;
+  ++cache.size;
+}
+
+//============================================================================
+// work_stealing_pool
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructors / Destructor
+//----------------------------------------------------------------------------
+
+constexpr std::size_t bit::concurrency::work_stealing_pool::default_queue_capacity;
+
+bit::concurrency::work_stealing_pool::work_stealing_pool()
+  : work_stealing_pool( std::thread::hardware_concurrency() )
+{
+
+}
+
+bit::concurrency::work_stealing_pool
+  ::work_stealing_pool( std::size_t threads, std::size_t queue_capacity )
+  : m_workers(),
+    m_queue(queue_capacity),
+    m_idle(),
+    m_stopping(false)
+{
+  if( threads == 0 ) threads = 1;
+
+  // Every worker must exist before any of them starts stealing
+  m_workers.reserve( threads );
+  for( auto i = std::size_t(0); i < threads; ++i ) {
+    m_workers.push_back( std::unique_ptr<worker>( new worker() ) );
+    m_workers.back()->random = static_cast<std::uint32_t>(i * 0x9e3779b9u + 1);
+  }
+
+  for( auto i = std::size_t(0); i < threads; ++i ) {
+    m_workers[i]->thread = std::thread( &work_stealing_pool::work, this, i );
+  }
+}
+
+bit::concurrency::work_stealing_pool::~work_stealing_pool()
+{
+  assert( t_pool != this && "work_stealing_pool destroyed from its own worker" );
+
+  m_stopping.store(true, std::memory_order_release);
+  m_idle.notify_all();
+
+  for( auto& w : m_workers ) {
+    w->thread.join();
+  }
+
+  // Workers only stop once they find no work, but run whatever raced with
+  // the last of them
+  while( auto* node = find_task( nullptr ) ) {
+    execute( node );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Execution
+//----------------------------------------------------------------------------
+
+bool bit::concurrency::work_stealing_pool::run_pending_task()
+{
+  auto* self = (t_pool == this) ? m_workers[t_index].get() : nullptr;
+  auto* node = find_task( self );
+
+  if( node == nullptr ) return false;
+
+  execute( node );
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+void bit::concurrency::work_stealing_pool::schedule( detail::task_node* node )
+{
+  if( t_pool == this ) {
+    m_workers[t_index]->deque.push( node );
+  } else {
+    m_queue.push( node );
+  }
+  m_idle.notify_one();
+}
+
+bit::concurrency::detail::task_node*
+  bit::concurrency::work_stealing_pool::find_task( worker* self )
+  noexcept
+{
+  auto* node = static_cast<detail::task_node*>(nullptr);
+
+  if( self != nullptr && self->deque.pop( node ) ) {
+    return node;
+  }
+
+  if( m_queue.try_pop( node ) ) {
+    return node;
+  }
+
+  auto& random = (self != nullptr) ? self->random : t_random;
+  const auto count = m_workers.size();
+  const auto start = static_cast<std::size_t>(next_random( random )) % count;
+
+  for( auto i = std::size_t(0); i < count; ++i ) {
+    auto* victim = m_workers[(start + i) % count].get();
+
+    if( victim != self && victim->deque.steal( node ) ) {
+      return node;
+    }
+  }
+  return nullptr;
+}
+
+void bit::concurrency::work_stealing_pool::work( std::size_t index )
+{
+  t_pool  = this;
+  t_index = index;
+
+  auto* self = m_workers[index].get();
+
+  while( true ) {
+    auto* node = find_task( self );
+
+    for( auto spins = 0; node == nullptr && spins < idle_spins; ++spins ) {
+      cpu_relax();
+      node = find_task( self );
+    }
+
+    if( node != nullptr ) {
+      execute( node );
+      continue;
+    }
+
+    const auto key = m_idle.prepare_wait();
+
+    node = find_task( self );
+
+    if( node != nullptr ) {
+      m_idle.cancel_wait();
+      execute( node );
+      continue;
+    }
+
+    if( m_stopping.load(std::memory_order_acquire) ) {
+      m_idle.cancel_wait();
+      break;
+    }
+
+    m_idle.commit_wait( key );
+  }
+
+  t_pool = nullptr;
+}
+
+void bit::concurrency::work_stealing_pool::execute( detail::task_node* node )
+{
+  node->run( node );
+  detail::release_task_node( node );
+}
@@ -0,0 +1,162 @@
+#include <bit/concurrency/locks/semaphore.hpp>
+
+#include <linux/futex.h> // FUTEX_WAIT_PRIVATE, FUTEX_WAKE_PRIVATE
+#include <sys/syscall.h> // SYS_futex
+#include <unistd.h>      // ::syscall
+
+#include <ctime>   // ::timespec
+#include <climits> // INT_MAX
+#include <cassert>
+
+static_assert( sizeof(std::atomic<std::int32_t>) == sizeof(std::int32_t),
+               "futex word must be layout-compatible with std::int32_t" );
+
+namespace {
+
+  //--------------------------------------------------------------------------
+  // Futex Utilities
+  //--------------------------------------------------------------------------
+
+  /// \brief Parks the calling thread on \p word as long as it still contains
+  ///        \p expected
+  ///
+  /// This may return spuriously; callers are expected to re-check the state
+  ///
+  /// \param word the futex word
+  /// \param expected the value the word must contain for the thread to park
+  /// \param timeout the relative timeout, or \c nullptr to wait indefinitely
+  void futex_wait( std::atomic<std::int32_t>* word,
+                   std::int32_t expected,
+                   const ::timespec* timeout )
+  {
+    ::syscall( SYS_futex,
+               reinterpret_cast<std::int32_t*>(word),
+               FUTEX_WAIT_PRIVATE,
+               expected,
+               timeout,
+               nullptr,
+               0 );
+  }
+
+  /// \brief Wakes up to \p count threads parked on \p word with a single
+  ///        system call
+  ///
+  /// \param word the futex word
+  /// \param count the maximum number of threads to wake
+  void futex_wake( std::atomic<std::int32_t>* word, int count )
+  {
+    ::syscall( SYS_futex,
+               reinterpret_cast<std::int32_t*>(word),
+               FUTEX_WAKE_PRIVATE,
+               count,
+               nullptr,
+               nullptr,
+               0 );
+  }
+
+} // anonymous namespace
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+bit::concurrency::semaphore::semaphore()
+  : semaphore(0)
+{
+}
+
+bit::concurrency::semaphore::semaphore( int initial_count )
+  : m_count(initial_count),
+    m_waiters(0)
+{
+  assert( initial_count >= 0 );
+}
+
+//----------------------------------------------------------------------------
+
+bit::concurrency::semaphore::~semaphore()
+{
+  assert( m_waiters.load(std::memory_order_relaxed) == 0 );
+}
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+void bit::concurrency::semaphore::wait()
+{
+  while( !try_wait() ) {
+    // The waiter count must be published before the kernel re-reads the
+    // futex word; this pairs with the sequentially-consistent operations in
+    // 'signal' so that either the signaler sees this waiter, or the kernel
+    // sees the new count and refuses to park.
+    m_waiters.fetch_add(1, std::memory_order_seq_cst);
+    futex_wait( &m_count, 0, nullptr );
+    m_waiters.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+bool bit::concurrency::semaphore::try_wait()
+{
+  auto count = m_count.load(std::memory_order_relaxed);
+
+  while( count > 0 ) {
+    if( m_count.compare_exchange_weak( count, count - 1,
+                                       std::memory_order_acquire,
+                                       std::memory_order_relaxed ) ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void bit::concurrency::semaphore::signal( int count )
+{
+  assert( count >= 0 );
+
+  if( count == 0 ) return;
+
+  m_count.fetch_add(count, std::memory_order_seq_cst);
+
+  // Only enter the kernel if a thread is (or is about to be) parked. A
+  // single FUTEX_WAKE releases up to 'count' waiters at once.
+  if( m_waiters.load(std::memory_order_seq_cst) > 0 ) {
+    futex_wake( &m_count, count < INT_MAX ? count : INT_MAX );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+bool bit::concurrency::semaphore::try_wait( std::uint64_t usecs )
+{
+  constexpr auto nsecs_in_1_sec = 1000000000;
+
+  if( try_wait() ) return true;
+
+  // FUTEX_WAIT takes a relative timeout against CLOCK_MONOTONIC, so track the
+  // deadline against the steady clock to survive spurious wake-ups
+  const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::microseconds(usecs);
+
+  while( true ) {
+    const auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      deadline - std::chrono::steady_clock::now()
+    ).count();
+
+    if( remaining <= 0 ) {
+      return try_wait();
+    }
+
+    ::timespec ts;
+    ts.tv_sec  = static_cast<::time_t>(remaining / nsecs_in_1_sec);
+    ts.tv_nsec = static_cast<long>(remaining % nsecs_in_1_sec);
+
+    m_waiters.fetch_add(1, std::memory_order_seq_cst);
+    futex_wait( &m_count, 0, &ts );
+    m_waiters.fetch_sub(1, std::memory_order_relaxed);
+
+    if( try_wait() ) return true;
+  }
+}
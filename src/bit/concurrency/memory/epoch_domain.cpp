@@ -0,0 +1,167 @@
+#include <bit/concurrency/memory/epoch_domain.hpp>
+
+#include <cassert>
+
+//============================================================================
+// epoch_domain
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor / Destructor
+//----------------------------------------------------------------------------
+
+constexpr std::size_t bit::concurrency::epoch_domain::default_batch_size;
+
+bit::concurrency::epoch_domain::epoch_domain( std::size_t batch_size )
+  : m_epoch(0),
+    m_registry(),
+    m_batch_size(batch_size)
+{
+  assert( batch_size > 0 );
+}
+
+bit::concurrency::epoch_domain::~epoch_domain() = default;
+
+//----------------------------------------------------------------------------
+// Global Domain
+//----------------------------------------------------------------------------
+
+bit::concurrency::epoch_domain& bit::concurrency::epoch_domain::global()
+{
+  static epoch_domain s_domain;
+
+  return s_domain;
+}
+
+bit::concurrency::epoch_domain::participant&
+  bit::concurrency::epoch_domain::this_thread_participant()
+{
+  // The main thread's thread-local objects are destroyed before any static
+  // one, so this never outlives the domain
+  thread_local participant s_participant( global() );
+
+  return s_participant;
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+bit::concurrency::epoch_domain::record::record()
+  noexcept
+  : state(0),
+    in_use(true),
+    next(nullptr),
+    nesting(0),
+    collect_at(0),
+    retired()
+{
+
+}
+
+//----------------------------------------------------------------------------
+
+bit::concurrency::epoch_domain::record*
+  bit::concurrency::epoch_domain::acquire_record()
+{
+  auto* r = m_registry.acquire();
+  r->collect_at = m_batch_size;
+
+  return r;
+}
+
+void bit::concurrency::epoch_domain::release_record( record* r )
+{
+  assert( r->nesting == 0 );
+
+  collect( r );
+
+  m_registry.release( r );
+}
+
+void bit::concurrency::epoch_domain::try_advance()
+  noexcept
+{
+  auto epoch = m_epoch->load(std::memory_order_relaxed);
+
+  // Pairs with the fence in 'participant::enter'
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  for( auto* r = m_registry.head(); r != nullptr; r = *r->next ) {
+    // Acquires the end of every region that the observed state follows, so
+    // that those regions happen-before any node freed in the new epoch
+    const auto state = r->state.load(std::memory_order_acquire);
+
+    // A participant is still pinned to an older epoch
+    if( (state & 1u) && (state >> 1) != epoch ) return;
+  }
+
+  // Failure means another thread advanced the epoch first
+  m_epoch->compare_exchange_strong( epoch, epoch + 1,
+                                    std::memory_order_release,
+                                    std::memory_order_relaxed );
+}
+
+void bit::concurrency::epoch_domain::collect( record* r )
+{
+  try_advance();
+
+  const auto epoch = m_epoch->load(std::memory_order_acquire);
+
+  m_registry.collect( r, [epoch]( const retired_node& node ) {
+    return node.epoch + 2 <= epoch;
+  } );
+
+  r->collect_at = r->retired.size() + m_batch_size;
+}
+
+//============================================================================
+// epoch_domain::participant
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor / Destructor
+//----------------------------------------------------------------------------
+
+bit::concurrency::epoch_domain::participant::participant( epoch_domain& domain )
+  : m_domain(&domain),
+    m_record(domain.acquire_record())
+{
+
+}
+
+bit::concurrency::epoch_domain::participant::~participant()
+{
+  assert( !in_critical_region() &&
+          "participant destroyed inside a critical region" );
+
+  m_domain->release_record( m_record );
+}
+
+//----------------------------------------------------------------------------
+// Reclamation
+//----------------------------------------------------------------------------
+
+void bit::concurrency::epoch_domain::participant::retire( void* pointer,
+                                                          deleter_type deleter )
+{
+  assert( deleter != nullptr );
+
+  // The tag must be the global epoch, even inside a critical region: the
+  // epoch may already be one past this participant's pin, and a region
+  // pinned to that newer epoch can still reach the node. The unlink must be
+  // ordered before the read of the epoch, or the tag could be too old.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto epoch = m_domain->m_epoch->load(std::memory_order_relaxed);
+
+  m_record->retired.push_back( retired_node{ pointer, deleter, epoch } );
+
+  if( m_record->retired.size() >= m_record->collect_at ) {
+    m_domain->collect( m_record );
+  }
+}
+
+void bit::concurrency::epoch_domain::participant::collect()
+{
+  m_domain->collect( m_record );
+}
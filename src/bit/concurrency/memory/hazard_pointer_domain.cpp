@@ -0,0 +1,156 @@
+#include <bit/concurrency/memory/hazard_pointer_domain.hpp>
+
+#include <algorithm> // std::sort, std::binary_search
+#include <new>       // placement new
+
+//============================================================================
+// hazard_pointer_domain
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor / Destructor
+//----------------------------------------------------------------------------
+
+constexpr std::size_t bit::concurrency::hazard_pointer_domain::default_hazards;
+
+bit::concurrency::hazard_pointer_domain
+  ::hazard_pointer_domain( std::size_t hazards, std::size_t threshold )
+  : m_registry(),
+    m_hazards(hazards),
+    m_threshold(threshold)
+{
+  assert( hazards > 0 );
+}
+
+bit::concurrency::hazard_pointer_domain::~hazard_pointer_domain() = default;
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+bit::concurrency::hazard_pointer_domain::record::record( std::size_t hazards )
+  : hazards(static_cast<std::atomic<void*>*>(
+      detail::allocate_cache_lines( hazards * sizeof(std::atomic<void*>) )
+    )),
+    in_use(true),
+    next(nullptr),
+    collect_at(0),
+    retired()
+{
+  for( auto i = std::size_t(0); i < hazards; ++i ) {
+    ::new (static_cast<void*>(&this->hazards[i])) std::atomic<void*>(nullptr);
+  }
+}
+
+void bit::concurrency::hazard_pointer_domain::hazard_deleter
+  ::operator()( std::atomic<void*>* hazards )
+  const noexcept
+{
+  // std::atomic<void*> is trivially destructible
+  detail::deallocate_cache_lines( hazards );
+}
+
+//----------------------------------------------------------------------------
+
+bit::concurrency::hazard_pointer_domain::record*
+  bit::concurrency::hazard_pointer_domain::acquire_record()
+{
+  auto* r = m_registry.acquire( m_hazards );
+  r->collect_at = threshold();
+
+  return r;
+}
+
+void bit::concurrency::hazard_pointer_domain::release_record( record* r )
+{
+  for( auto i = std::size_t(0); i < m_hazards; ++i ) {
+    r->hazards[i].store(nullptr, std::memory_order_release);
+  }
+
+  collect( r );
+
+  m_registry.release( r );
+}
+
+std::size_t bit::concurrency::hazard_pointer_domain::threshold()
+  const noexcept
+{
+  const auto total = m_registry.size() * m_hazards;
+
+  return m_threshold > 2 * total ? m_threshold : 2 * total;
+}
+
+void bit::concurrency::hazard_pointer_domain::collect( record* r )
+{
+  // Pairs with the fence in 'participant::set'
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  auto protected_ = std::vector<void*>();
+  protected_.reserve( m_registry.size() * m_hazards );
+
+  for( auto* it = m_registry.head(); it != nullptr; it = *it->next ) {
+    for( auto i = std::size_t(0); i < m_hazards; ++i ) {
+      auto* pointer = it->hazards[i].load(std::memory_order_relaxed);
+
+      if( pointer != nullptr ) {
+        protected_.push_back( pointer );
+      }
+    }
+  }
+
+  // Orders the scan before any deletion, so that clears observed by the scan
+  // happen-before the node is deleted
+  std::atomic_thread_fence(std::memory_order_acquire);
+
+  std::sort( protected_.begin(), protected_.end() );
+
+  m_registry.collect( r, [&protected_]( const retired_node& node ) {
+    return !std::binary_search( protected_.begin(),
+                                protected_.end(),
+                                node.pointer );
+  } );
+
+  r->collect_at = r->retired.size() + threshold();
+}
+
+//============================================================================
+// hazard_pointer_domain::participant
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Constructor / Destructor
+//----------------------------------------------------------------------------
+
+bit::concurrency::hazard_pointer_domain::participant
+  ::participant( hazard_pointer_domain& domain )
+  : m_domain(&domain),
+    m_record(domain.acquire_record())
+{
+
+}
+
+bit::concurrency::hazard_pointer_domain::participant::~participant()
+{
+  m_domain->release_record( m_record );
+}
+
+//----------------------------------------------------------------------------
+// Reclamation
+//----------------------------------------------------------------------------
+
+void bit::concurrency::hazard_pointer_domain::participant
+  ::retire( void* pointer, deleter_type deleter )
+{
+  assert( deleter != nullptr );
+
+  m_record->retired.push_back( retired_node{ pointer, deleter } );
+
+  if( m_record->retired.size() >= m_record->collect_at ) {
+    m_domain->collect( m_record );
+  }
+}
+
+void bit::concurrency::hazard_pointer_domain::participant::collect()
+{
+  m_domain->collect( m_record );
+}
@@ -0,0 +1,35 @@
+#include <bit/concurrency/utilities/per_cpu.hpp>
+
+#if defined(_WIN32)
+# ifndef NOMINMAX
+#  define NOMINMAX 1
+# endif
+# ifndef WIN32_LEAN_AND_MEAN
+#  define WIN32_LEAN_AND_MEAN 1
+# endif
+# include <windows.h>
+#elif defined(__linux__)
+# include <sched.h> // ::sched_getcpu
+#endif
+
+//----------------------------------------------------------------------------
+// Processor Index
+//----------------------------------------------------------------------------
+
+std::size_t bit::concurrency::this_cpu_index()
+  noexcept
+{
+#if defined(_WIN32)
+  return static_cast<std::size_t>(::GetCurrentProcessorNumber());
+#elif defined(__linux__)
+  // Served from the vDSO, or from rseq, without entering the kernel
+  const auto cpu = ::sched_getcpu();
+
+  if( cpu >= 0 ) {
+    return static_cast<std::size_t>(cpu);
+  }
+  return this_thread_index();
+#else
+  return this_thread_index();
+#endif
+}
@@ -0,0 +1,172 @@
+#include <bit/concurrency/utilities/striped_counter.hpp>
+
+#include <algorithm> // std::min, std::max
+#include <new>       // std::nothrow
+#include <thread>    // std::thread::hardware_concurrency
+#include <utility>   // std::move
+
+//============================================================================
+// striped_counter::cell_array
+//============================================================================
+
+bit::concurrency::striped_counter::cell_array
+  ::cell_array( std::unique_ptr<cell[]> cells,
+                std::size_t size,
+                cell_array* previous )
+  noexcept
+  : cells(std::move(cells)),
+    mask(size - 1),
+    previous(previous)
+{
+
+}
+
+//============================================================================
+// striped_counter
+//============================================================================
+
+//----------------------------------------------------------------------------
+// Destructor
+//----------------------------------------------------------------------------
+
+bit::concurrency::striped_counter::~striped_counter()
+{
+  auto* array = m_cells.load(std::memory_order_relaxed);
+
+  while( array != nullptr ) {
+    auto* previous = array->previous;
+    delete array;
+    array = previous;
+  }
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+void bit::concurrency::striped_counter::reset()
+  noexcept
+{
+  m_base->store(0, std::memory_order_relaxed);
+
+  auto* array = m_cells.load(std::memory_order_acquire);
+  for( ; array != nullptr; array = array->previous ) {
+    for( auto i = std::size_t(0); i <= array->mask; ++i ) {
+      array->cells[i]->store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+bit::concurrency::striped_counter::value_type
+  bit::concurrency::striped_counter::read()
+  const noexcept
+{
+  auto sum = m_base->load(std::memory_order_relaxed);
+
+  auto* array = m_cells.load(std::memory_order_acquire);
+  for( ; array != nullptr; array = array->previous ) {
+    for( auto i = std::size_t(0); i <= array->mask; ++i ) {
+      sum += array->cells[i]->load(std::memory_order_relaxed);
+    }
+  }
+  return sum;
+}
+
+bit::concurrency::striped_counter::value_type
+  bit::concurrency::striped_counter::read_and_reset()
+  noexcept
+{
+  auto sum = m_base->exchange(0, std::memory_order_relaxed);
+
+  auto* array = m_cells.load(std::memory_order_acquire);
+  for( ; array != nullptr; array = array->previous ) {
+    for( auto i = std::size_t(0); i <= array->mask; ++i ) {
+      sum += array->cells[i]->exchange(0, std::memory_order_relaxed);
+    }
+  }
+  return sum;
+}
+
+std::size_t bit::concurrency::striped_counter::cells()
+  const noexcept
+{
+  const auto* array = m_cells.load(std::memory_order_acquire);
+
+  return (array == nullptr) ? 0 : array->mask + 1;
+}
+
+//----------------------------------------------------------------------------
+// Private Member Functions
+//----------------------------------------------------------------------------
+
+void bit::concurrency::striped_counter::add_contended( value_type n,
+                                                       cell_array* array )
+  noexcept
+{
+  array = grow( array );
+
+  // Out of memory before any cells were allocated; the base is still
+  // correct, if contended
+  if( array == nullptr ) {
+    m_base->fetch_add(n, std::memory_order_relaxed);
+    return;
+  }
+
+  array->cells[this_cpu_index() & array->mask]->fetch_add(n, std::memory_order_relaxed);
+}
+
+bit::concurrency::striped_counter::cell_array*
+  bit::concurrency::striped_counter::grow( cell_array* array )
+  noexcept
+{
+  const auto limit = max_cells();
+
+  if( array != nullptr && array->mask + 1 >= limit ) {
+    return array;
+  }
+
+  const auto size = (array == nullptr) ? std::min<std::size_t>( 2, limit )
+                                       : (array->mask + 1) * 2;
+
+  auto storage = std::unique_ptr<cell[]>( new (std::nothrow) cell[size] );
+  if( storage == nullptr ) {
+    return array;
+  }
+
+  auto* next = new (std::nothrow) cell_array( std::move(storage), size, array );
+  if( next == nullptr ) {
+    return array;
+  }
+
+  // The old array stays reachable through 'previous', so updates still
+  // landing in it are counted
+  auto expected = array;
+  if( m_cells.compare_exchange_strong( expected, next,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_acquire ) ) {
+    return next;
+  }
+
+  delete next;
+  return expected;
+}
+
+std::size_t bit::concurrency::striped_counter::max_cells()
+  noexcept
+{
+  static const auto s_max_cells = []{
+    const auto threads = std::max( 1u, std::thread::hardware_concurrency() );
+
+    auto result = std::size_t(1);
+    while( result < threads ) {
+      result <<= 1;
+    }
+    return result;
+  }();
+
+  return s_max_cells;
+}
@@ -0,0 +1,271 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the concurrent_hash_map
+ *****************************************************************************/
+
+#include <bit/concurrency/containers/concurrent_hash_map.hpp>
+
+#include <catch.hpp>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::concurrent_hash_map;
+using bit::concurrency::epoch_domain;
+
+//----------------------------------------------------------------------------
+// Lookup / Modifiers
+//----------------------------------------------------------------------------
+
+TEST_CASE("concurrent_hash_map::insert()", "[containers][concurrent_hash_map]")
+{
+  concurrent_hash_map<int,std::string> map;
+
+  SECTION("A new map is empty")
+  {
+    REQUIRE( map.empty() );
+    REQUIRE( map.size() == 0u );
+    REQUIRE_FALSE( map.contains(1) );
+  }
+
+  SECTION("Inserting a new key succeeds")
+  {
+    REQUIRE( map.insert(1, "one") );
+
+    auto value = std::string();
+    REQUIRE( map.find(1, value) );
+    REQUIRE( value == "one" );
+    REQUIRE( map.size() == 1u );
+  }
+
+  SECTION("Inserting a present key keeps the current value")
+  {
+    map.insert(1, "one");
+
+    REQUIRE_FALSE( map.insert(1, "uno") );
+
+    auto value = std::string();
+    map.find(1, value);
+    REQUIRE( value == "one" );
+    REQUIRE( map.size() == 1u );
+  }
+
+  SECTION("Emplacing constructs the value in place")
+  {
+    REQUIRE( map.emplace(1, 3u, 'x') );
+
+    auto value = std::string();
+    map.find(1, value);
+    REQUIRE( value == "xxx" );
+  }
+}
+
+TEST_CASE("concurrent_hash_map::insert_or_assign()", "[containers][concurrent_hash_map]")
+{
+  concurrent_hash_map<int,std::string> map;
+
+  SECTION("Inserts an absent key")
+  {
+    REQUIRE( map.insert_or_assign(1, "one") );
+    REQUIRE( map.contains(1) );
+  }
+
+  SECTION("Replaces the value of a present key")
+  {
+    map.insert(1, "one");
+
+    REQUIRE_FALSE( map.insert_or_assign(1, "uno") );
+
+    auto value = std::string();
+    map.find(1, value);
+    REQUIRE( value == "uno" );
+    REQUIRE( map.size() == 1u );
+  }
+}
+
+TEST_CASE("concurrent_hash_map::erase()", "[containers][concurrent_hash_map]")
+{
+  concurrent_hash_map<int,std::string> map;
+
+  SECTION("Erasing an absent key fails")
+  {
+    REQUIRE_FALSE( map.erase(1) );
+  }
+
+  SECTION("Erasing a present key removes it")
+  {
+    map.insert(1, "one");
+    map.insert(2, "two");
+
+    REQUIRE( map.erase(1) );
+    REQUIRE_FALSE( map.contains(1) );
+    REQUIRE( map.contains(2) );
+    REQUIRE( map.size() == 1u );
+  }
+
+  SECTION("An erased key can be inserted again")
+  {
+    map.insert(1, "one");
+    map.erase(1);
+
+    REQUIRE( map.insert(1, "uno") );
+  }
+}
+
+TEST_CASE("concurrent_hash_map::visit()", "[containers][concurrent_hash_map]")
+{
+  concurrent_hash_map<int,std::string> map;
+  map.insert(1, "one");
+
+  auto length = std::size_t(0);
+
+  SECTION("Visits the value of a present key")
+  {
+    REQUIRE( map.visit(1, [&]( const std::string& s ){ length = s.size(); }) );
+    REQUIRE( length == 3u );
+  }
+
+  SECTION("Does not invoke the function for an absent key")
+  {
+    REQUIRE_FALSE( map.visit(2, [&]( const std::string& s ){ length = s.size(); }) );
+    REQUIRE( length == 0u );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Resizing
+//----------------------------------------------------------------------------
+
+TEST_CASE("concurrent_hash_map across a resize", "[containers][concurrent_hash_map]")
+{
+  concurrent_hash_map<int,int> map;
+  const auto initial_buckets = map.bucket_count();
+  const auto count = static_cast<int>(initial_buckets * 8);
+
+  for( auto i = 0; i < count; ++i ) {
+    map.insert(i, i);
+  }
+
+  SECTION("The table grows")
+  {
+    REQUIRE( map.bucket_count() > initial_buckets );
+    REQUIRE( map.size() == static_cast<std::size_t>(count) );
+  }
+
+  SECTION("Every key is found with its value")
+  {
+    for( auto i = 0; i < count; ++i ) {
+      auto value = -1;
+      REQUIRE( map.find(i, value) );
+      REQUIRE( value == i );
+    }
+    REQUIRE_FALSE( map.contains(count) );
+  }
+
+  SECTION("Assignments and erasures apply to the new table")
+  {
+    for( auto i = 0; i < count; i += 2 ) {
+      REQUIRE( map.erase(i) );
+    }
+    for( auto i = 1; i < count; i += 2 ) {
+      REQUIRE_FALSE( map.insert_or_assign(i, -i) );
+    }
+
+    for( auto i = 0; i < count; ++i ) {
+      auto value = 0;
+      if( i % 2 == 0 ) {
+        REQUIRE_FALSE( map.find(i, value) );
+      } else {
+        REQUIRE( map.find(i, value) );
+        REQUIRE( value == -i );
+      }
+    }
+    REQUIRE( map.size() == static_cast<std::size_t>(count / 2) );
+  }
+}
+
+TEST_CASE("concurrent_hash_map destroys its values", "[containers][concurrent_hash_map]")
+{
+  auto value = std::make_shared<int>(0);
+
+  SECTION("Values still in the map are destroyed with it")
+  {
+    {
+      concurrent_hash_map<int,std::shared_ptr<int>> map;
+      for( auto i = 0; i < 256; ++i ) {
+        map.insert(i, value);
+      }
+    }
+
+    REQUIRE( value.use_count() == 1 );
+  }
+
+  SECTION("Removed values are destroyed once collected")
+  {
+    {
+      concurrent_hash_map<int,std::shared_ptr<int>> map;
+      for( auto i = 0; i < 256; ++i ) {
+        map.insert(i, value);
+      }
+      for( auto i = 0; i < 128; ++i ) {
+        map.erase(i);
+      }
+      map.insert_or_assign(200, std::make_shared<int>(1));
+    }
+
+    auto& p = epoch_domain::this_thread_participant();
+    for( auto i = 0; i < 4; ++i ) {
+      p.collect();
+    }
+
+    REQUIRE( value.use_count() == 1 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("concurrent_hash_map with concurrent writers", "[containers][concurrent_hash_map]")
+{
+  static constexpr auto threads = 4;
+  static constexpr auto per_thread = 2000;
+
+  concurrent_hash_map<int,int> map;
+  auto workers = std::vector<std::thread>{};
+
+  for( auto t = 0; t < threads; ++t ) {
+    workers.emplace_back([&map,t]{
+      for( auto i = 0; i < per_thread; ++i ) {
+        const auto key = t * per_thread + i;
+        map.insert(key, key);
+        // Every key is also looked up by a neighbour, which races the resize
+        auto value = 0;
+        map.find((key + per_thread) % (threads * per_thread), value);
+      }
+      for( auto i = 0; i < per_thread; i += 2 ) {
+        map.erase(t * per_thread + i);
+      }
+    });
+  }
+  for( auto& w : workers ) {
+    w.join();
+  }
+
+  SECTION("No key is lost or duplicated")
+  {
+    REQUIRE( map.size() == static_cast<std::size_t>(threads * per_thread / 2) );
+
+    for( auto key = 0; key < threads * per_thread; ++key ) {
+      auto value = -1;
+      if( key % 2 == 0 ) {
+        REQUIRE_FALSE( map.find(key, value) );
+      } else {
+        REQUIRE( map.find(key, value) );
+        REQUIRE( value == key );
+      }
+    }
+  }
+}
@@ -0,0 +1,136 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the intrusive_mpsc_queue
+ *****************************************************************************/
+
+#include <bit/concurrency/containers/intrusive_mpsc_queue.hpp>
+
+#include <catch.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::intrusive_mpsc_queue;
+using bit::concurrency::mpsc_queue_hook;
+using namespace std::chrono_literals;
+
+namespace {
+
+  struct message : mpsc_queue_hook
+  {
+    int value = 0;
+  };
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// Consumer
+//----------------------------------------------------------------------------
+
+TEST_CASE("intrusive_mpsc_queue::try_pop()", "[containers][intrusive_mpsc_queue]")
+{
+  intrusive_mpsc_queue<message> queue;
+  message messages[3];
+  for( auto i = 0; i < 3; ++i ) {
+    messages[i].value = i;
+  }
+
+  SECTION("Popping from an empty queue returns null")
+  {
+    REQUIRE( queue.try_pop() == nullptr );
+  }
+
+  SECTION("Elements are popped in the order they were pushed")
+  {
+    for( auto& m : messages ) {
+      queue.push(&m);
+    }
+
+    REQUIRE( queue.try_pop() == &messages[0] );
+    REQUIRE( queue.try_pop() == &messages[1] );
+    REQUIRE( queue.try_pop() == &messages[2] );
+    REQUIRE( queue.try_pop() == nullptr );
+  }
+
+  SECTION("A popped element can be pushed again")
+  {
+    queue.push(&messages[0]);
+    queue.try_pop();
+    queue.push(&messages[1]);
+    queue.push(&messages[0]);
+
+    REQUIRE( queue.try_pop() == &messages[1] );
+    REQUIRE( queue.try_pop() == &messages[0] );
+    REQUIRE( queue.try_pop() == nullptr );
+  }
+}
+
+TEST_CASE("intrusive_mpsc_queue::pop_for()", "[containers][intrusive_mpsc_queue]")
+{
+  intrusive_mpsc_queue<message,true> queue;
+  message m;
+
+  SECTION("Times out on an empty queue")
+  {
+    const auto start = std::chrono::steady_clock::now();
+
+    REQUIRE( queue.pop_for(20ms) == nullptr );
+    REQUIRE( std::chrono::steady_clock::now() - start >= 20ms );
+  }
+
+  SECTION("Wakes when an element is pushed")
+  {
+    auto producer = std::thread{[&]{
+      std::this_thread::sleep_for(10ms);
+      queue.push(&m);
+    }};
+
+    REQUIRE( queue.pop_for(10s) == &m );
+
+    producer.join();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("intrusive_mpsc_queue with concurrent producers", "[containers][intrusive_mpsc_queue]")
+{
+  static constexpr auto producers = 4;
+  static constexpr auto per_producer = 2000;
+
+  intrusive_mpsc_queue<message,true> queue;
+  auto messages = std::vector<message>(producers * per_producer);
+  auto threads = std::vector<std::thread>{};
+
+  for( auto p = 0; p < producers; ++p ) {
+    threads.emplace_back([&,p]{
+      for( auto i = 0; i < per_producer; ++i ) {
+        auto& m = messages[p * per_producer + i];
+        m.value = i;
+        queue.push(&m);
+      }
+    });
+  }
+
+  // Each producer's messages arrive in the order it pushed them
+  auto next = std::vector<int>(producers, 0);
+  auto in_order = true;
+  for( auto i = 0; i < producers * per_producer; ++i ) {
+    auto* m = queue.pop();
+    const auto p = static_cast<int>(m - messages.data()) / per_producer;
+    in_order = in_order && (m->value == next[p]);
+    ++next[p];
+  }
+  for( auto& t : threads ) {
+    t.join();
+  }
+
+  REQUIRE( in_order );
+  REQUIRE( queue.try_pop() == nullptr );
+  for( auto count : next ) {
+    REQUIRE( count == per_producer );
+  }
+}
@@ -0,0 +1,229 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the mpmc_queue
+ *****************************************************************************/
+
+#include <bit/concurrency/containers/mpmc_queue.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::mpmc_queue;
+using namespace std::chrono_literals;
+
+//----------------------------------------------------------------------------
+// Capacity
+//----------------------------------------------------------------------------
+
+TEST_CASE("mpmc_queue::capacity()", "[containers][mpmc_queue]")
+{
+  SECTION("The capacity is rounded up to a power of two")
+  {
+    mpmc_queue<int> queue{ 5 };
+
+    REQUIRE( queue.capacity() == 8u );
+  }
+
+  SECTION("A power of two capacity is kept")
+  {
+    mpmc_queue<int> queue{ 16 };
+
+    REQUIRE( queue.capacity() == 16u );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Modifiers
+//----------------------------------------------------------------------------
+
+TEST_CASE("mpmc_queue::try_push()", "[containers][mpmc_queue]")
+{
+  mpmc_queue<int> queue{ 4 };
+
+  SECTION("Pushing to a queue with room succeeds")
+  {
+    REQUIRE( queue.try_push(1) );
+  }
+
+  SECTION("Pushing to a full queue fails")
+  {
+    for( auto i = 0; i < 4; ++i ) {
+      REQUIRE( queue.try_push(i) );
+    }
+
+    REQUIRE_FALSE( queue.try_push(4) );
+  }
+
+  SECTION("Popping from a full queue makes room")
+  {
+    for( auto i = 0; i < 4; ++i ) {
+      queue.try_push(i);
+    }
+    auto value = 0;
+    queue.try_pop(value);
+
+    REQUIRE( queue.try_push(4) );
+  }
+}
+
+TEST_CASE("mpmc_queue::try_pop()", "[containers][mpmc_queue]")
+{
+  mpmc_queue<int> queue{ 4 };
+  auto value = -1;
+
+  SECTION("Popping from an empty queue fails")
+  {
+    REQUIRE_FALSE( queue.try_pop(value) );
+    REQUIRE( value == -1 );
+  }
+
+  SECTION("Elements are popped in the order they were pushed")
+  {
+    // Wrap around the ring a few times
+    for( auto i = 0; i < 10; ++i ) {
+      queue.try_push(i);
+      queue.try_push(i + 100);
+
+      REQUIRE( queue.try_pop(value) );
+      REQUIRE( value == i );
+      REQUIRE( queue.try_pop(value) );
+      REQUIRE( value == i + 100 );
+    }
+    REQUIRE_FALSE( queue.try_pop(value) );
+  }
+
+  SECTION("Move-only elements are moved through the queue")
+  {
+    mpmc_queue<std::unique_ptr<int>> pointers{ 2 };
+    auto out = std::unique_ptr<int>{};
+
+    REQUIRE( pointers.try_push(std::unique_ptr<int>(new int(5))) );
+    REQUIRE( pointers.try_pop(out) );
+    REQUIRE( *out == 5 );
+  }
+}
+
+TEST_CASE("mpmc_queue::pop_for()", "[containers][mpmc_queue]")
+{
+  mpmc_queue<int> queue{ 4 };
+  auto value = -1;
+
+  SECTION("Times out on an empty queue")
+  {
+    const auto start = std::chrono::steady_clock::now();
+
+    REQUIRE_FALSE( queue.pop_for(value, 20ms) );
+    REQUIRE( std::chrono::steady_clock::now() - start >= 20ms );
+  }
+
+  SECTION("Returns an element that is already present")
+  {
+    queue.push(3);
+
+    REQUIRE( queue.pop_for(value, 20ms) );
+    REQUIRE( value == 3 );
+  }
+
+  SECTION("Wakes when an element is pushed")
+  {
+    auto producer = std::thread{[&]{
+      std::this_thread::sleep_for(10ms);
+      queue.push(7);
+    }};
+
+    REQUIRE( queue.pop_for(value, 10s) );
+    REQUIRE( value == 7 );
+
+    producer.join();
+  }
+}
+
+TEST_CASE("mpmc_queue::pop_until()", "[containers][mpmc_queue]")
+{
+  mpmc_queue<int> queue{ 4 };
+  auto value = -1;
+
+  SECTION("Times out on an empty queue")
+  {
+    REQUIRE_FALSE( queue.pop_until(value, std::chrono::steady_clock::now() + 10ms) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("mpmc_queue with concurrent producers and consumers", "[containers][mpmc_queue]")
+{
+  static constexpr auto producers = 2;
+  static constexpr auto consumers = 2;
+  static constexpr auto per_producer = 5000;
+  static constexpr auto total = producers * per_producer;
+
+  mpmc_queue<int> queue{ 64 };
+  auto seen = std::vector<std::atomic<int>>(total);
+  std::atomic<long long> sum{ 0 };
+  auto threads = std::vector<std::thread>{};
+
+  SECTION("Blocking push and pop")
+  {
+    for( auto p = 0; p < producers; ++p ) {
+      threads.emplace_back([&,p]{
+        for( auto i = 0; i < per_producer; ++i ) {
+          queue.push(p * per_producer + i);
+        }
+      });
+    }
+    for( auto c = 0; c < consumers; ++c ) {
+      threads.emplace_back([&]{
+        for( auto i = 0; i < total / consumers; ++i ) {
+          auto value = 0;
+          queue.pop(value);
+          seen[value].fetch_add(1, std::memory_order_relaxed);
+          sum.fetch_add(value, std::memory_order_relaxed);
+        }
+      });
+    }
+  }
+
+  SECTION("Non-blocking push and pop")
+  {
+    for( auto p = 0; p < producers; ++p ) {
+      threads.emplace_back([&,p]{
+        for( auto i = 0; i < per_producer; ++i ) {
+          while( !queue.try_push(p * per_producer + i) ) {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+    for( auto c = 0; c < consumers; ++c ) {
+      threads.emplace_back([&]{
+        for( auto i = 0; i < total / consumers; ++i ) {
+          auto value = 0;
+          while( !queue.try_pop(value) ) {
+            std::this_thread::yield();
+          }
+          seen[value].fetch_add(1, std::memory_order_relaxed);
+          sum.fetch_add(value, std::memory_order_relaxed);
+        }
+      });
+    }
+  }
+
+  for( auto& t : threads ) {
+    t.join();
+  }
+
+  auto value = 0;
+  REQUIRE_FALSE( queue.try_pop(value) );
+  REQUIRE( sum == static_cast<long long>(total) * (total - 1) / 2 );
+  for( auto i = 0; i < total; ++i ) {
+    REQUIRE( seen[i] == 1 );
+  }
+}
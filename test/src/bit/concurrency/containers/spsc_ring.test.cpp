@@ -0,0 +1,224 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the spsc_ring
+ *****************************************************************************/
+
+#include <bit/concurrency/containers/spsc_ring.hpp>
+
+#include <catch.hpp>
+
+#include <chrono>
+#include <memory>
+#include <new>
+#include <thread>
+
+using bit::concurrency::spsc_ring;
+using namespace std::chrono_literals;
+
+//----------------------------------------------------------------------------
+// Capacity
+//----------------------------------------------------------------------------
+
+TEST_CASE("spsc_ring::capacity()", "[containers][spsc_ring]")
+{
+  spsc_ring<int> ring{ 5 };
+
+  REQUIRE( ring.capacity() == 8u );
+}
+
+TEST_CASE("spsc_ring without blocking holds no parking state", "[containers][spsc_ring]")
+{
+  STATIC_REQUIRE( sizeof(spsc_ring<int>) < sizeof(spsc_ring<int,true>) );
+}
+
+//----------------------------------------------------------------------------
+// Producer / Consumer
+//----------------------------------------------------------------------------
+
+TEST_CASE("spsc_ring::try_push()", "[containers][spsc_ring]")
+{
+  spsc_ring<int> ring{ 4 };
+
+  SECTION("Pushing to a full ring fails")
+  {
+    for( auto i = 0; i < 4; ++i ) {
+      REQUIRE( ring.try_push(i) );
+    }
+
+    REQUIRE_FALSE( ring.try_push(4) );
+  }
+
+  SECTION("Popping from a full ring makes room")
+  {
+    for( auto i = 0; i < 4; ++i ) {
+      ring.try_push(i);
+    }
+    auto value = 0;
+    ring.try_pop(value);
+
+    REQUIRE( ring.try_push(4) );
+  }
+}
+
+TEST_CASE("spsc_ring::try_pop()", "[containers][spsc_ring]")
+{
+  spsc_ring<int> ring{ 4 };
+  auto value = -1;
+
+  SECTION("Popping from an empty ring fails")
+  {
+    REQUIRE_FALSE( ring.try_pop(value) );
+    REQUIRE( value == -1 );
+  }
+
+  SECTION("Elements are popped in the order they were pushed")
+  {
+    for( auto i = 0; i < 10; ++i ) {
+      ring.try_push(i);
+      ring.try_push(i + 100);
+
+      REQUIRE( ring.try_pop(value) );
+      REQUIRE( value == i );
+      REQUIRE( ring.try_pop(value) );
+      REQUIRE( value == i + 100 );
+    }
+    REQUIRE_FALSE( ring.try_pop(value) );
+  }
+}
+
+TEST_CASE("spsc_ring::try_reserve()", "[containers][spsc_ring]")
+{
+  spsc_ring<int> ring{ 8 };
+
+  SECTION("Reserves no more than the free cells")
+  {
+    auto cells = ring.try_reserve(16);
+
+    REQUIRE( cells.size() == 8u );
+  }
+
+  SECTION("A full ring reserves nothing")
+  {
+    for( auto i = 0; i < 8; ++i ) {
+      ring.try_push(i);
+    }
+
+    REQUIRE( ring.try_reserve(1).empty() );
+  }
+
+  SECTION("Committed cells are peeked and consumed as a batch")
+  {
+    auto cells = ring.try_reserve(3);
+    REQUIRE( cells.size() == 3u );
+    for( auto i = 0u; i < cells.size(); ++i ) {
+      ::new (static_cast<void*>(cells.data() + i)) int( static_cast<int>(i) );
+    }
+
+    REQUIRE( ring.peek().empty() );
+    ring.commit(3);
+
+    auto readable = ring.peek();
+    REQUIRE( readable.size() == 3u );
+    REQUIRE( readable.data()[0] == 0 );
+    REQUIRE( readable.data()[2] == 2 );
+
+    ring.consume(3);
+    REQUIRE( ring.peek().empty() );
+  }
+
+  SECTION("Reservations stop at the end of the ring")
+  {
+    for( auto i = 0; i < 6; ++i ) {
+      ring.try_push(i);
+    }
+    auto value = 0;
+    for( auto i = 0; i < 6; ++i ) {
+      ring.try_pop(value);
+    }
+
+    REQUIRE( ring.try_reserve(8).size() == 2u );
+  }
+}
+
+TEST_CASE("spsc_ring destroys its elements", "[containers][spsc_ring]")
+{
+  auto value = std::make_shared<int>(0);
+
+  {
+    spsc_ring<std::shared_ptr<int>> ring{ 4 };
+    ring.try_push(value);
+    ring.try_push(value);
+    ring.peek();
+    ring.consume(1);
+  }
+
+  REQUIRE( value.use_count() == 1 );
+}
+
+//----------------------------------------------------------------------------
+// Blocking
+//----------------------------------------------------------------------------
+
+TEST_CASE("spsc_ring::wait_peek_for()", "[containers][spsc_ring]")
+{
+  spsc_ring<int,true> ring{ 4 };
+
+  SECTION("Times out on an empty ring")
+  {
+    const auto start = std::chrono::steady_clock::now();
+
+    REQUIRE( ring.wait_peek_for(20ms).empty() );
+    REQUIRE( std::chrono::steady_clock::now() - start >= 20ms );
+  }
+
+  SECTION("Wakes when an element is pushed")
+  {
+    auto producer = std::thread{[&]{
+      std::this_thread::sleep_for(10ms);
+      ring.try_push(7);
+    }};
+
+    auto readable = ring.wait_peek_for(10s);
+    REQUIRE( readable.size() == 1u );
+    REQUIRE( readable.data()[0] == 7 );
+
+    producer.join();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("spsc_ring with a concurrent producer and consumer", "[containers][spsc_ring]")
+{
+  static constexpr auto count = 20000;
+
+  spsc_ring<int,true> ring{ 64 };
+
+  auto producer = std::thread{[&]{
+    auto next = 0;
+    while( next != count ) {
+      auto cells = ring.reserve(static_cast<std::size_t>(count - next));
+      for( auto& cell : cells ) {
+        ::new (static_cast<void*>(&cell)) int( next++ );
+      }
+      ring.commit(cells.size());
+    }
+  }};
+
+  auto expected = 0;
+  auto in_order = true;
+  while( expected != count ) {
+    auto readable = ring.wait_peek();
+    for( auto value : readable ) {
+      in_order = in_order && (value == expected);
+      ++expected;
+    }
+    ring.consume(readable.size());
+  }
+  producer.join();
+
+  REQUIRE( in_order );
+  REQUIRE( ring.peek().empty() );
+}
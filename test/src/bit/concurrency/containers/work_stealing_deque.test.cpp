@@ -0,0 +1,118 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the work_stealing_deque
+ *****************************************************************************/
+
+#include <bit/concurrency/containers/work_stealing_deque.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::work_stealing_deque;
+
+//----------------------------------------------------------------------------
+// Owner / Thieves
+//----------------------------------------------------------------------------
+
+TEST_CASE("work_stealing_deque::pop()", "[containers][work_stealing_deque]")
+{
+  work_stealing_deque<int> deque{ 4 };
+  auto value = -1;
+
+  SECTION("A new deque is empty")
+  {
+    REQUIRE( deque.empty() );
+    REQUIRE_FALSE( deque.pop(value) );
+    REQUIRE_FALSE( deque.steal(value) );
+  }
+
+  SECTION("The owner pops the most recent element")
+  {
+    deque.push(1);
+    deque.push(2);
+
+    REQUIRE( deque.pop(value) );
+    REQUIRE( value == 2 );
+    REQUIRE( deque.pop(value) );
+    REQUIRE( value == 1 );
+    REQUIRE_FALSE( deque.pop(value) );
+  }
+
+  SECTION("Thieves steal the oldest element")
+  {
+    deque.push(1);
+    deque.push(2);
+
+    REQUIRE( deque.steal(value) );
+    REQUIRE( value == 1 );
+    REQUIRE( deque.pop(value) );
+    REQUIRE( value == 2 );
+    REQUIRE( deque.empty() );
+  }
+
+  SECTION("The deque grows past its initial capacity")
+  {
+    for( auto i = 0; i < 100; ++i ) {
+      deque.push(i);
+    }
+
+    for( auto i = 99; i >= 0; --i ) {
+      REQUIRE( deque.pop(value) );
+      REQUIRE( value == i );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("work_stealing_deque with concurrent thieves", "[containers][work_stealing_deque]")
+{
+  static constexpr auto thieves = 3;
+  static constexpr auto count = 20000;
+
+  work_stealing_deque<int> deque{ 8 };
+  auto seen = std::vector<std::atomic<int>>(count);
+  std::atomic<int> taken{ 0 };
+  auto threads = std::vector<std::thread>{};
+
+  for( auto t = 0; t < thieves; ++t ) {
+    threads.emplace_back([&]{
+      auto value = 0;
+      while( taken.load() != count ) {
+        if( deque.steal(value) ) {
+          seen[value].fetch_add(1, std::memory_order_relaxed);
+          taken.fetch_add(1);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  // The owner interleaves pushes with pops, so that it races the thieves
+  // for the last element
+  auto value = 0;
+  for( auto i = 0; i < count; ++i ) {
+    deque.push(i);
+    if( i % 3 == 0 && deque.pop(value) ) {
+      seen[value].fetch_add(1, std::memory_order_relaxed);
+      taken.fetch_add(1);
+    }
+  }
+  while( deque.pop(value) ) {
+    seen[value].fetch_add(1, std::memory_order_relaxed);
+    taken.fetch_add(1);
+  }
+  for( auto& t : threads ) {
+    t.join();
+  }
+
+  for( auto i = 0; i < count; ++i ) {
+    REQUIRE( seen[i] == 1 );
+  }
+}
@@ -0,0 +1,150 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the async_event
+ *****************************************************************************/
+
+#include <bit/concurrency/coroutines/async_event.hpp>
+#include <bit/concurrency/executors/work_stealing_pool.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <thread>
+
+using bit::concurrency::async_event;
+using bit::concurrency::work_stealing_pool;
+
+namespace {
+
+  /// A coroutine that starts eagerly and is never awaited
+  struct detached
+  {
+    struct promise_type
+    {
+      detached get_return_object() noexcept{ return {}; }
+      std::suspend_never initial_suspend() noexcept{ return {}; }
+      std::suspend_never final_suspend() noexcept{ return {}; }
+      void return_void() noexcept{}
+      void unhandled_exception() noexcept{ std::terminate(); }
+    };
+  };
+
+  /// Waits until \p count reaches \p expected
+  void wait_for_count( const std::atomic<int>& count, int expected )
+  {
+    while( count.load() < expected ) {
+      std::this_thread::yield();
+    }
+  }
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// Automatic Reset
+//----------------------------------------------------------------------------
+
+TEST_CASE("async_event::signal() with automatic reset", "[coroutines][async_event]")
+{
+  async_event event;
+  std::atomic<int> done{ 0 };
+
+  const auto wait_once = [&]() -> detached {
+    co_await event.wait_async();
+    done.fetch_add(1);
+  };
+
+  SECTION("A signal is consumed by a single wait")
+  {
+    event.signal();
+
+    REQUIRE( event.try_wait() );
+    REQUIRE_FALSE( event.try_wait() );
+  }
+
+  SECTION("A signal resumes a single waiter")
+  {
+    wait_once();
+    wait_once();
+
+    event.signal();
+    REQUIRE( done == 1 );
+    REQUIRE_FALSE( event.try_wait() );
+
+    event.signal();
+    REQUIRE( done == 2 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Manual Reset
+//----------------------------------------------------------------------------
+
+TEST_CASE("async_event::signal() with manual reset", "[coroutines][async_event]")
+{
+  async_event event{ async_event::reset_mode::manual };
+  std::atomic<int> done{ 0 };
+
+  const auto wait_once = [&]() -> detached {
+    co_await event.wait_async();
+    done.fetch_add(1);
+  };
+
+  SECTION("A signal resumes every waiter and stays set")
+  {
+    wait_once();
+    wait_once();
+
+    event.signal();
+    REQUIRE( done == 2 );
+    REQUIRE( event.try_wait() );
+    REQUIRE( event.try_wait() );
+  }
+
+  SECTION("Reset clears the signal")
+  {
+    event.signal();
+    event.reset();
+
+    REQUIRE_FALSE( event.try_wait() );
+    wait_once();
+    REQUIRE( done == 0 );
+
+    event.signal();
+    REQUIRE( done == 1 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("async_event releases concurrent waiters", "[coroutines][async_event]")
+{
+  static constexpr auto coroutines = 64;
+
+  async_event event{ async_event::reset_mode::manual };
+  std::atomic<int> started{ 0 };
+  std::atomic<int> done{ 0 };
+
+  {
+    work_stealing_pool pool{ 4 };
+
+    const auto wait_once = [&]() -> detached {
+      started.fetch_add(1);
+      co_await event.wait_async(pool);
+      done.fetch_add(1);
+    };
+
+    for( auto c = 0; c < coroutines; ++c ) {
+      pool.post([&]{ wait_once(); });
+    }
+    // Signal while some waiters are still arriving
+    wait_for_count(started, coroutines / 2);
+    event.signal();
+    wait_for_count(done, coroutines);
+  }
+
+  REQUIRE( done == coroutines );
+}
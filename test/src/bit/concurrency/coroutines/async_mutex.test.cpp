@@ -0,0 +1,133 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the async_mutex
+ *****************************************************************************/
+
+#include <bit/concurrency/coroutines/async_mutex.hpp>
+#include <bit/concurrency/executors/work_stealing_pool.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <thread>
+
+using bit::concurrency::async_mutex;
+using bit::concurrency::work_stealing_pool;
+
+namespace {
+
+  /// A coroutine that starts eagerly and is never awaited
+  struct detached
+  {
+    struct promise_type
+    {
+      detached get_return_object() noexcept{ return {}; }
+      std::suspend_never initial_suspend() noexcept{ return {}; }
+      std::suspend_never final_suspend() noexcept{ return {}; }
+      void return_void() noexcept{}
+      void unhandled_exception() noexcept{ std::terminate(); }
+    };
+  };
+
+  /// Waits until \p count reaches \p expected
+  void wait_for_count( const std::atomic<int>& count, int expected )
+  {
+    while( count.load() < expected ) {
+      std::this_thread::yield();
+    }
+  }
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+TEST_CASE("async_mutex::try_lock()", "[coroutines][async_mutex]")
+{
+  async_mutex mutex;
+
+  SECTION("An unlocked mutex is acquired")
+  {
+    REQUIRE( mutex.try_lock() );
+    mutex.unlock();
+  }
+
+  SECTION("A held mutex is not acquired")
+  {
+    mutex.try_lock();
+
+    REQUIRE_FALSE( mutex.try_lock() );
+    mutex.unlock();
+
+    REQUIRE( mutex.try_lock() );
+    mutex.unlock();
+  }
+}
+
+TEST_CASE("async_mutex::lock_async()", "[coroutines][async_mutex]")
+{
+  async_mutex mutex;
+  std::atomic<int> done{ 0 };
+
+  const auto lock_once = [&]() -> detached {
+    co_await mutex.lock_async();
+    done.fetch_add(1);
+    mutex.unlock();
+  };
+
+  SECTION("An unlocked mutex is acquired without suspending")
+  {
+    lock_once();
+
+    REQUIRE( done == 1 );
+  }
+
+  SECTION("A waiter is resumed when the mutex is unlocked")
+  {
+    mutex.try_lock();
+    lock_once();
+    REQUIRE( done == 0 );
+
+    mutex.unlock();
+    REQUIRE( done == 1 );
+    REQUIRE( mutex.try_lock() );
+    mutex.unlock();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("async_mutex with concurrent coroutines", "[coroutines][async_mutex]")
+{
+  static constexpr auto coroutines = 16;
+  static constexpr auto iterations = 500;
+
+  async_mutex mutex;
+  auto counter = 0;
+  std::atomic<int> done{ 0 };
+
+  {
+    work_stealing_pool pool{ 4 };
+
+    const auto increment = [&]() -> detached {
+      for( auto i = 0; i < iterations; ++i ) {
+        co_await mutex.lock_async(pool);
+        ++counter;
+        mutex.unlock();
+      }
+      done.fetch_add(1);
+    };
+
+    for( auto c = 0; c < coroutines; ++c ) {
+      pool.post([&]{ increment(); });
+    }
+    wait_for_count(done, coroutines);
+  }
+
+  REQUIRE( counter == coroutines * iterations );
+}
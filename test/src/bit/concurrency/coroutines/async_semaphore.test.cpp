@@ -0,0 +1,141 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the async_semaphore
+ *****************************************************************************/
+
+#include <bit/concurrency/coroutines/async_semaphore.hpp>
+#include <bit/concurrency/executors/work_stealing_pool.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <thread>
+
+using bit::concurrency::async_semaphore;
+using bit::concurrency::work_stealing_pool;
+
+namespace {
+
+  /// A coroutine that starts eagerly and is never awaited
+  struct detached
+  {
+    struct promise_type
+    {
+      detached get_return_object() noexcept{ return {}; }
+      std::suspend_never initial_suspend() noexcept{ return {}; }
+      std::suspend_never final_suspend() noexcept{ return {}; }
+      void return_void() noexcept{}
+      void unhandled_exception() noexcept{ std::terminate(); }
+    };
+  };
+
+  /// Waits until \p count reaches \p expected
+  void wait_for_count( const std::atomic<int>& count, int expected )
+  {
+    while( count.load() < expected ) {
+      std::this_thread::yield();
+    }
+  }
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// Waiting
+//----------------------------------------------------------------------------
+
+TEST_CASE("async_semaphore::try_wait()", "[coroutines][async_semaphore]")
+{
+  async_semaphore semaphore{ 2 };
+
+  SECTION("Each wait takes one count")
+  {
+    REQUIRE( semaphore.try_wait() );
+    REQUIRE( semaphore.try_wait() );
+    REQUIRE_FALSE( semaphore.try_wait() );
+  }
+
+  SECTION("Signal adds to the count")
+  {
+    semaphore.signal(2);
+
+    for( auto i = 0; i < 4; ++i ) {
+      REQUIRE( semaphore.try_wait() );
+    }
+    REQUIRE_FALSE( semaphore.try_wait() );
+  }
+}
+
+TEST_CASE("async_semaphore::wait_async()", "[coroutines][async_semaphore]")
+{
+  async_semaphore semaphore;
+  std::atomic<int> done{ 0 };
+
+  const auto wait_once = [&]() -> detached {
+    co_await semaphore.wait_async();
+    done.fetch_add(1);
+  };
+
+  SECTION("Waiters are resumed one per signal")
+  {
+    wait_once();
+    wait_once();
+    REQUIRE( done == 0 );
+
+    semaphore.signal();
+    REQUIRE( done == 1 );
+    semaphore.signal();
+    REQUIRE( done == 2 );
+    REQUIRE_FALSE( semaphore.try_wait() );
+  }
+
+  SECTION("A signal without waiters is kept for the next wait")
+  {
+    semaphore.signal();
+    wait_once();
+
+    REQUIRE( done == 1 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("async_semaphore bounds concurrent coroutines", "[coroutines][async_semaphore]")
+{
+  static constexpr auto limit = 3;
+  static constexpr auto coroutines = 16;
+  static constexpr auto iterations = 200;
+
+  async_semaphore semaphore{ limit };
+  std::atomic<int> inside{ 0 };
+  std::atomic<int> exceeded{ 0 };
+  std::atomic<int> done{ 0 };
+
+  {
+    work_stealing_pool pool{ 4 };
+
+    const auto enter = [&]() -> detached {
+      for( auto i = 0; i < iterations; ++i ) {
+        co_await semaphore.wait_async(pool);
+        if( inside.fetch_add(1) >= limit ) exceeded.fetch_add(1);
+        inside.fetch_sub(1);
+        semaphore.signal();
+      }
+      done.fetch_add(1);
+    };
+
+    for( auto c = 0; c < coroutines; ++c ) {
+      pool.post([&]{ enter(); });
+    }
+    wait_for_count(done, coroutines);
+  }
+
+  REQUIRE( exceeded == 0 );
+  for( auto i = 0; i < limit; ++i ) {
+    REQUIRE( semaphore.try_wait() );
+  }
+  REQUIRE_FALSE( semaphore.try_wait() );
+}
@@ -0,0 +1,135 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the work_stealing_pool
+ *****************************************************************************/
+
+#include <bit/concurrency/executors/work_stealing_pool.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::work_stealing_pool;
+
+namespace {
+
+  /// Sums [first, last) by forking the halves onto the pool
+  long long fork_sum( work_stealing_pool& pool, long long first, long long last )
+  {
+    if( last - first <= 64 ) {
+      auto sum = 0ll;
+      for( auto i = first; i != last; ++i ) sum += i;
+      return sum;
+    }
+
+    const auto middle = first + (last - first) / 2;
+    auto left = pool.submit([&pool,first,middle]{
+      return fork_sum(pool, first, middle);
+    });
+    const auto right = fork_sum(pool, middle, last);
+
+    while( left.wait_for(std::chrono::seconds(0)) != std::future_status::ready ) {
+      if( !pool.run_pending_task() ) std::this_thread::yield();
+    }
+    return left.get() + right;
+  }
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+TEST_CASE("work_stealing_pool::size()", "[executors][work_stealing_pool]")
+{
+  SECTION("Starts the requested number of workers")
+  {
+    work_stealing_pool pool{ 3 };
+
+    REQUIRE( pool.size() == 3u );
+  }
+
+  SECTION("Starts at least one worker")
+  {
+    work_stealing_pool pool{ 0 };
+
+    REQUIRE( pool.size() == 1u );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Scheduling
+//----------------------------------------------------------------------------
+
+TEST_CASE("work_stealing_pool::submit()", "[executors][work_stealing_pool]")
+{
+  work_stealing_pool pool{ 2 };
+
+  SECTION("The future holds the result")
+  {
+    auto result = pool.submit([]{ return 42; });
+
+    REQUIRE( result.get() == 42 );
+  }
+
+  SECTION("The future holds the exception")
+  {
+    auto result = pool.submit([]() -> int { throw std::runtime_error("x"); });
+
+    REQUIRE_THROWS_AS( result.get(), std::runtime_error );
+  }
+}
+
+TEST_CASE("work_stealing_pool::post()", "[executors][work_stealing_pool]")
+{
+  static constexpr auto tasks = 5000;
+
+  std::atomic<int> count{ 0 };
+
+  SECTION("Every posted task runs before the pool is destroyed")
+  {
+    {
+      work_stealing_pool pool{ 4, 64 };
+      for( auto i = 0; i < tasks; ++i ) {
+        pool.post([&count]{ count.fetch_add(1, std::memory_order_relaxed); });
+      }
+    }
+
+    REQUIRE( count == tasks );
+  }
+
+  SECTION("Tasks posted from workers run")
+  {
+    {
+      work_stealing_pool pool{ 4 };
+      for( auto i = 0; i < tasks / 10; ++i ) {
+        pool.post([&pool,&count]{
+          for( auto j = 0; j < 10; ++j ) {
+            pool.post([&count]{ count.fetch_add(1, std::memory_order_relaxed); });
+          }
+        });
+      }
+    }
+
+    REQUIRE( count == tasks );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("work_stealing_pool with forked work", "[executors][work_stealing_pool]")
+{
+  static constexpr auto count = 20000ll;
+
+  work_stealing_pool pool{ 4 };
+  auto result = pool.submit([&pool]{ return fork_sum(pool, 0, count); });
+
+  REQUIRE( result.get() == count * (count - 1) / 2 );
+}
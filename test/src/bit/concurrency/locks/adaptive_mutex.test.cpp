@@ -0,0 +1,121 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the adaptive_mutex
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/adaptive_mutex.hpp>
+
+#include <catch.hpp>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::adaptive_mutex;
+using namespace std::chrono_literals;
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+TEST_CASE("adaptive_mutex::try_lock()", "[locks][adaptive_mutex]")
+{
+  adaptive_mutex lock;
+
+  SECTION("An unlocked lock is acquired")
+  {
+    REQUIRE( lock.try_lock() );
+    lock.unlock();
+  }
+
+  SECTION("A held lock is not acquired")
+  {
+    lock.lock();
+
+    REQUIRE_FALSE( lock.try_lock() );
+    lock.unlock();
+  }
+
+  SECTION("A released lock is acquired again")
+  {
+    lock.lock();
+    lock.unlock();
+
+    REQUIRE( lock.try_lock() );
+    lock.unlock();
+  }
+}
+
+TEST_CASE("adaptive_mutex::try_lock_for()", "[locks][adaptive_mutex]")
+{
+  adaptive_mutex lock;
+
+  SECTION("An unlocked lock is acquired")
+  {
+    REQUIRE( lock.try_lock_for(20ms) );
+    lock.unlock();
+  }
+
+  SECTION("Times out while another thread holds the lock")
+  {
+    lock.lock();
+
+    auto acquired = true;
+    auto waited = std::chrono::steady_clock::duration{};
+    auto waiter = std::thread{[&]{
+      const auto start = std::chrono::steady_clock::now();
+      acquired = lock.try_lock_for(20ms);
+      waited = std::chrono::steady_clock::now() - start;
+    }};
+    waiter.join();
+    lock.unlock();
+
+    REQUIRE_FALSE( acquired );
+    REQUIRE( waited >= 20ms );
+  }
+
+  SECTION("Acquires the lock once it is released")
+  {
+    lock.lock();
+
+    auto acquired = false;
+    auto waiter = std::thread{[&]{
+      acquired = lock.try_lock_for(10s);
+      if( acquired ) lock.unlock();
+    }};
+    std::this_thread::sleep_for(10ms);
+    lock.unlock();
+    waiter.join();
+
+    REQUIRE( acquired );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("adaptive_mutex excludes concurrent threads", "[locks][adaptive_mutex]")
+{
+  static constexpr auto threads = 4;
+  static constexpr auto iterations = 5000;
+
+  adaptive_mutex lock;
+  auto counter = 0;
+  auto workers = std::vector<std::thread>{};
+
+  for( auto t = 0; t < threads; ++t ) {
+    workers.emplace_back([&]{
+      for( auto i = 0; i < iterations; ++i ) {
+        std::lock_guard<adaptive_mutex> guard{lock};
+        ++counter;
+      }
+    });
+  }
+  for( auto& w : workers ) {
+    w.join();
+  }
+
+  REQUIRE( counter == threads * iterations );
+}
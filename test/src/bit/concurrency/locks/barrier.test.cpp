@@ -0,0 +1,93 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the barrier
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/barrier.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::barrier;
+
+namespace {
+
+  struct count_phases
+  {
+    std::atomic<int>* phases;
+
+    void operator()() noexcept{ phases->fetch_add(1); }
+  };
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// Arrival
+//----------------------------------------------------------------------------
+
+TEST_CASE("barrier::arrive()", "[locks][barrier]")
+{
+  std::atomic<int> phases{ 0 };
+
+  SECTION("A single thread completes each phase on arrival")
+  {
+    barrier<count_phases> b{ 1, count_phases{&phases} };
+
+    b.wait( b.arrive() );
+    b.arrive_and_wait();
+
+    REQUIRE( phases == 2 );
+  }
+
+  SECTION("A phase completes on its last arrival")
+  {
+    barrier<count_phases> b{ 3, count_phases{&phases} };
+
+    const auto token = b.arrive();
+    b.arrive();
+    REQUIRE( phases == 0 );
+    b.arrive();
+    REQUIRE( phases == 1 );
+
+    b.wait( token );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("barrier keeps threads in step", "[locks][barrier]")
+{
+  // More than 'fan_in' threads, so that the tree has several levels
+  static constexpr auto threads = 6;
+  static constexpr auto rounds = 50;
+
+  std::atomic<int> phases{ 0 };
+  barrier<count_phases> b{ threads, count_phases{&phases} };
+  std::atomic<int> arrivals{ 0 };
+  std::atomic<int> out_of_step{ 0 };
+  auto workers = std::vector<std::thread>{};
+
+  for( auto t = 0; t < threads; ++t ) {
+    workers.emplace_back([&]{
+      for( auto r = 0; r < rounds; ++r ) {
+        arrivals.fetch_add(1);
+        b.arrive_and_wait();
+        // Every thread of this round arrived, and none of the next one can
+        // have, so the count is exact between the two waits
+        if( arrivals.load() != threads * (r + 1) ) out_of_step.fetch_add(1);
+        b.arrive_and_wait();
+      }
+    });
+  }
+  for( auto& w : workers ) {
+    w.join();
+  }
+
+  REQUIRE( out_of_step == 0 );
+  REQUIRE( phases == 2 * rounds );
+}
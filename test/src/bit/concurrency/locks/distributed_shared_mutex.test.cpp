@@ -0,0 +1,129 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the distributed_shared_mutex
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/distributed_shared_mutex.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::distributed_shared_mutex;
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+TEST_CASE("distributed_shared_mutex::try_lock()", "[locks][distributed_shared_mutex]")
+{
+  distributed_shared_mutex mutex;
+
+  SECTION("An unlocked mutex is acquired")
+  {
+    REQUIRE( mutex.try_lock() );
+    mutex.unlock();
+  }
+
+  SECTION("A mutex held exclusively is not acquired")
+  {
+    mutex.lock();
+
+    REQUIRE_FALSE( mutex.try_lock() );
+    mutex.unlock();
+  }
+
+  SECTION("A mutex held by a reader is not acquired")
+  {
+    mutex.lock_shared();
+
+    REQUIRE_FALSE( mutex.try_lock() );
+    mutex.unlock_shared();
+
+    REQUIRE( mutex.try_lock() );
+    mutex.unlock();
+  }
+}
+
+TEST_CASE("distributed_shared_mutex::try_lock_shared()", "[locks][distributed_shared_mutex]")
+{
+  distributed_shared_mutex mutex;
+
+  SECTION("An unlocked mutex is acquired")
+  {
+    REQUIRE( mutex.try_lock_shared() );
+    mutex.unlock_shared();
+  }
+
+  SECTION("Readers share the mutex")
+  {
+    mutex.lock_shared();
+
+    auto acquired = false;
+    auto reader = std::thread{[&]{
+      acquired = mutex.try_lock_shared();
+      if( acquired ) mutex.unlock_shared();
+    }};
+    reader.join();
+    mutex.unlock_shared();
+
+    REQUIRE( acquired );
+  }
+
+  SECTION("A mutex held exclusively is not acquired")
+  {
+    mutex.lock();
+
+    REQUIRE_FALSE( mutex.try_lock_shared() );
+    mutex.unlock();
+
+    REQUIRE( mutex.try_lock_shared() );
+    mutex.unlock_shared();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("distributed_shared_mutex with concurrent readers and writers", "[locks][distributed_shared_mutex]")
+{
+  static constexpr auto writers = 2;
+  static constexpr auto readers = 2;
+  static constexpr auto iterations = 2000;
+
+  distributed_shared_mutex mutex;
+  auto first = 0;
+  auto second = 0;
+  std::atomic<int> torn{ 0 };
+  auto threads = std::vector<std::thread>{};
+
+  for( auto t = 0; t < writers; ++t ) {
+    threads.emplace_back([&]{
+      for( auto i = 0; i < iterations; ++i ) {
+        std::lock_guard<distributed_shared_mutex> guard{mutex};
+        ++first;
+        ++second;
+      }
+    });
+  }
+  for( auto t = 0; t < readers; ++t ) {
+    threads.emplace_back([&]{
+      for( auto i = 0; i < iterations; ++i ) {
+        mutex.lock_shared();
+        if( first != second ) torn.fetch_add(1);
+        mutex.unlock_shared();
+      }
+    });
+  }
+  for( auto& t : threads ) {
+    t.join();
+  }
+
+  REQUIRE( torn == 0 );
+  REQUIRE( first == writers * iterations );
+  REQUIRE( second == writers * iterations );
+}
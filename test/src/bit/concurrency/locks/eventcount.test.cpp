@@ -0,0 +1,164 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the eventcount
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/eventcount.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::eventcount;
+using namespace std::chrono_literals;
+
+//----------------------------------------------------------------------------
+// Waiting
+//----------------------------------------------------------------------------
+
+TEST_CASE("eventcount::commit_wait()", "[locks][eventcount]")
+{
+  eventcount event;
+
+  SECTION("Returns immediately after a notify that follows prepare_wait")
+  {
+    const auto key = event.prepare_wait();
+    event.notify_one();
+
+    event.commit_wait(key);
+  }
+
+  SECTION("Wakes on a notify from another thread")
+  {
+    std::atomic<bool> ready{ false };
+    auto notifier = std::thread{[&]{
+      std::this_thread::sleep_for(10ms);
+      ready.store(true);
+      event.notify_all();
+    }};
+
+    while( !ready.load() ) {
+      const auto key = event.prepare_wait();
+      if( ready.load() ) {
+        event.cancel_wait();
+        break;
+      }
+      event.commit_wait(key);
+    }
+    notifier.join();
+
+    REQUIRE( ready.load() );
+  }
+}
+
+TEST_CASE("eventcount::commit_wait_until()", "[locks][eventcount]")
+{
+  eventcount event;
+
+  SECTION("Times out without a notify")
+  {
+    const auto start = std::chrono::steady_clock::now();
+    const auto key = event.prepare_wait();
+
+    REQUIRE_FALSE( event.commit_wait_until(key, start + 20ms) );
+    REQUIRE( std::chrono::steady_clock::now() - start >= 20ms );
+  }
+
+  SECTION("Does not time out after a notify")
+  {
+    const auto key = event.prepare_wait();
+    event.notify_one();
+
+    REQUIRE( event.commit_wait_until(key, std::chrono::steady_clock::now() + 10s) );
+  }
+
+  SECTION("A notify before prepare_wait does not satisfy the wait")
+  {
+    event.notify_all();
+    const auto key = event.prepare_wait();
+
+    REQUIRE_FALSE( event.commit_wait_until(key, std::chrono::steady_clock::now() + 10ms) );
+  }
+}
+
+TEST_CASE("eventcount::cancel_wait()", "[locks][eventcount]")
+{
+  eventcount event;
+
+  SECTION("A cancelled waiter does not absorb a notify")
+  {
+    event.prepare_wait();
+    event.cancel_wait();
+
+    const auto key = event.prepare_wait();
+    event.notify_one();
+
+    REQUIRE( event.commit_wait_until(key, std::chrono::steady_clock::now() + 10s) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("eventcount guarding a counter", "[locks][eventcount]")
+{
+  static constexpr auto consumers = 3;
+  static constexpr auto items = 3000;
+
+  eventcount event;
+  std::atomic<int> available{ 0 };
+  std::atomic<int> consumed{ 0 };
+  auto threads = std::vector<std::thread>{};
+
+  // Takes one unit of 'available', if there is one
+  const auto try_take = [&]{
+    auto n = available.load();
+    while( n > 0 ) {
+      if( available.compare_exchange_weak(n, n - 1) ) return true;
+    }
+    return false;
+  };
+
+  for( auto c = 0; c < consumers; ++c ) {
+    threads.emplace_back([&]{
+      while( consumed.load() < items ) {
+        if( try_take() ) {
+          consumed.fetch_add(1);
+          continue;
+        }
+        const auto key = event.prepare_wait();
+        if( try_take() ) {
+          event.cancel_wait();
+          consumed.fetch_add(1);
+          continue;
+        }
+        if( consumed.load() >= items ) {
+          event.cancel_wait();
+          break;
+        }
+        event.commit_wait(key);
+      }
+    });
+  }
+
+  for( auto i = 0; i < items; ++i ) {
+    available.fetch_add(1);
+    event.notify_one();
+  }
+  // Wake the consumers that are left waiting once everything is consumed
+  while( consumed.load() < items ) {
+    std::this_thread::yield();
+  }
+  event.notify_all();
+
+  for( auto& t : threads ) {
+    t.join();
+  }
+
+  REQUIRE( consumed == items );
+  REQUIRE( available == 0 );
+}
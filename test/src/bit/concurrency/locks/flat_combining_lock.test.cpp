@@ -0,0 +1,104 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the flat_combining_lock
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/flat_combining_lock.hpp>
+
+#include <catch.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::flat_combining_lock;
+
+//----------------------------------------------------------------------------
+// Operations
+//----------------------------------------------------------------------------
+
+TEST_CASE("flat_combining_lock::apply()", "[locks][flat_combining_lock]")
+{
+  SECTION("The value is value-initialized")
+  {
+    flat_combining_lock<int> lock;
+
+    REQUIRE( lock.apply([]( int& v ){ return v; }) == 0 );
+  }
+
+  SECTION("Returns the result of the function")
+  {
+    flat_combining_lock<int> lock{ 5 };
+
+    REQUIRE( lock.apply([]( int& v ){ return ++v; }) == 6 );
+    REQUIRE( lock.apply([]( int& v ){ return v * 2; }) == 12 );
+  }
+
+  SECTION("Functions may return void")
+  {
+    flat_combining_lock<int> lock{ 5 };
+
+    lock.apply([]( int& v ){ v = 7; });
+
+    REQUIRE( lock.apply([]( int& v ){ return v; }) == 7 );
+  }
+
+  SECTION("Move-only results are moved out")
+  {
+    flat_combining_lock<int> lock{ 5 };
+
+    auto p = lock.apply([]( int& v ){ return std::unique_ptr<int>(new int(v)); });
+
+    REQUIRE( *p == 5 );
+  }
+
+  SECTION("Exceptions are rethrown on the calling thread")
+  {
+    flat_combining_lock<int> lock{ 5 };
+
+    REQUIRE_THROWS_AS( lock.apply([]( int& ) -> int { throw std::runtime_error("x"); }),
+                       std::runtime_error );
+
+    // The lock is still usable
+    REQUIRE( lock.apply([]( int& v ){ return v; }) == 5 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("flat_combining_lock with concurrent callers", "[locks][flat_combining_lock]")
+{
+  static constexpr auto iterations = 5000;
+
+  auto run = []( auto& lock, int threads ) {
+    auto workers = std::vector<std::thread>{};
+    for( auto t = 0; t < threads; ++t ) {
+      workers.emplace_back([&]{
+        for( auto i = 0; i < iterations; ++i ) {
+          lock.apply([]( long& v ){ ++v; });
+        }
+      });
+    }
+    for( auto& w : workers ) {
+      w.join();
+    }
+    return lock.apply([]( long& v ){ return v; });
+  };
+
+  SECTION("Every thread has a slot")
+  {
+    flat_combining_lock<long> lock;
+
+    REQUIRE( run(lock, 4) == 4l * iterations );
+  }
+
+  SECTION("Threads share slots")
+  {
+    flat_combining_lock<long,2> lock;
+
+    REQUIRE( run(lock, 4) == 4l * iterations );
+  }
+}
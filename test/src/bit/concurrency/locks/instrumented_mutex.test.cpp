@@ -0,0 +1,119 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the instrumented_mutex
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/instrumented_mutex.hpp>
+#include <bit/concurrency/locks/clh_lock.hpp>
+#include <bit/concurrency/locks/spin_lock.hpp>
+
+#include <catch.hpp>
+
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::instrumented_mutex;
+using bit::concurrency::clh_lock;
+using bit::concurrency::spin_lock;
+
+//----------------------------------------------------------------------------
+// Statistics
+//----------------------------------------------------------------------------
+
+TEST_CASE("instrumented_mutex::snapshot()", "[locks][instrumented_mutex]")
+{
+  instrumented_mutex<spin_lock> mutex;
+
+  SECTION("A new mutex has no statistics")
+  {
+    const auto stats = mutex.snapshot();
+
+    REQUIRE( stats.acquisitions == 0u );
+    REQUIRE( stats.contended == 0u );
+    REQUIRE( stats.contended_fraction() == 0.0 );
+  }
+
+  SECTION("Uncontended acquisitions are counted")
+  {
+    for( auto i = 0; i < 3; ++i ) {
+      mutex.lock();
+      mutex.unlock();
+    }
+    const auto stats = mutex.snapshot();
+
+    REQUIRE( stats.acquisitions == 3u );
+    REQUIRE( stats.contended == 0u );
+    REQUIRE( std::accumulate(stats.hold_histogram.begin(), stats.hold_histogram.end(),
+                             std::uint64_t(0)) == 3u );
+  }
+
+  SECTION("A failed try_lock is not counted")
+  {
+    mutex.lock();
+    REQUIRE_FALSE( mutex.try_lock() );
+    mutex.unlock();
+
+    REQUIRE( mutex.snapshot().acquisitions == 1u );
+  }
+
+  SECTION("Reset clears the statistics")
+  {
+    mutex.lock();
+    mutex.unlock();
+    mutex.reset();
+
+    REQUIRE( mutex.snapshot().acquisitions == 0u );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("instrumented_mutex with concurrent threads", "[locks][instrumented_mutex]")
+{
+  static constexpr auto threads = 4;
+  static constexpr auto iterations = 2000;
+
+  auto run = []( auto& mutex ) {
+    auto counter = 0;
+    auto workers = std::vector<std::thread>{};
+    for( auto t = 0; t < threads; ++t ) {
+      workers.emplace_back([&]{
+        for( auto i = 0; i < iterations; ++i ) {
+          mutex.lock();
+          ++counter;
+          mutex.unlock();
+        }
+      });
+    }
+    for( auto& w : workers ) {
+      w.join();
+    }
+    return counter;
+  };
+
+  SECTION("Every acquisition is counted")
+  {
+    instrumented_mutex<spin_lock> mutex;
+
+    REQUIRE( run(mutex) == threads * iterations );
+
+    const auto stats = mutex.snapshot();
+    REQUIRE( stats.acquisitions == static_cast<std::uint64_t>(threads * iterations) );
+    REQUIRE( stats.contended <= stats.acquisitions );
+  }
+
+  SECTION("A lock without try_lock is never counted as contended")
+  {
+    instrumented_mutex<clh_lock> mutex;
+
+    REQUIRE( run(mutex) == threads * iterations );
+
+    const auto stats = mutex.snapshot();
+    REQUIRE( stats.acquisitions == static_cast<std::uint64_t>(threads * iterations) );
+    REQUIRE( stats.contended == 0u );
+  }
+}
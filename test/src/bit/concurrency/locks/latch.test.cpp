@@ -0,0 +1,74 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the latch
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/latch.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::latch;
+
+//----------------------------------------------------------------------------
+// Counting
+//----------------------------------------------------------------------------
+
+TEST_CASE("latch::count_down()", "[locks][latch]")
+{
+  SECTION("A latch with no count is open")
+  {
+    latch l{ 0 };
+
+    REQUIRE( l.try_wait() );
+    l.wait();
+  }
+
+  SECTION("The latch opens once the count reaches zero")
+  {
+    latch l{ 3 };
+
+    l.count_down();
+    REQUIRE_FALSE( l.try_wait() );
+    l.count_down(2);
+    REQUIRE( l.try_wait() );
+    l.wait();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("latch releases every waiter", "[locks][latch]")
+{
+  static constexpr auto threads = 4;
+
+  latch start{ 1 };
+  latch done{ threads };
+  std::atomic<int> before{ 0 };
+  std::atomic<int> after{ 0 };
+  auto workers = std::vector<std::thread>{};
+
+  for( auto t = 0; t < threads; ++t ) {
+    workers.emplace_back([&]{
+      start.wait();
+      before.fetch_add(1);
+      done.arrive_and_wait();
+      // Every thread arrived before any passed the latch
+      if( before.load() == threads ) after.fetch_add(1);
+    });
+  }
+
+  REQUIRE( before == 0 );
+  start.count_down();
+  done.wait();
+  for( auto& w : workers ) {
+    w.join();
+  }
+
+  REQUIRE( after == threads );
+}
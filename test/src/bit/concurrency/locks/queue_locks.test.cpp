@@ -0,0 +1,94 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the fair queue locks: ticket_lock, mcs_lock and
+ *        clh_lock
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/clh_lock.hpp>
+#include <bit/concurrency/locks/mcs_lock.hpp>
+#include <bit/concurrency/locks/ticket_lock.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::clh_lock;
+using bit::concurrency::mcs_lock;
+using bit::concurrency::ticket_lock;
+using namespace std::chrono_literals;
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+TEMPLATE_TEST_CASE("Queue locks are held independently of each other", "[locks][queue_locks]",
+                   ticket_lock, mcs_lock, clh_lock)
+{
+  TestType first;
+  TestType second;
+
+  SECTION("A lock is acquired and released repeatedly")
+  {
+    for( auto i = 0; i < 100; ++i ) {
+      first.lock();
+      first.unlock();
+    }
+  }
+
+  SECTION("Several locks are held at once")
+  {
+    first.lock();
+    second.lock();
+    second.unlock();
+    first.unlock();
+
+    first.lock();
+    first.unlock();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Fairness
+//----------------------------------------------------------------------------
+
+TEMPLATE_TEST_CASE("Queue locks hand over in the order they were requested", "[locks][queue_locks]",
+                   ticket_lock, mcs_lock, clh_lock)
+{
+  static constexpr auto waiters = 4;
+
+  TestType lock;
+  std::atomic<int> started{ 0 };
+  auto order = std::vector<int>{};
+  auto threads = std::vector<std::thread>{};
+
+  lock.lock();
+
+  // Each waiter is queued before the next one is started
+  for( auto w = 0; w < waiters; ++w ) {
+    threads.emplace_back([&, w]{
+      started.store(w + 1, std::memory_order_release);
+
+      lock.lock();
+      order.push_back(w);
+      lock.unlock();
+    });
+
+    while( started.load(std::memory_order_acquire) != w + 1 ) {
+      std::this_thread::yield();
+    }
+    // The flag is raised just before 'lock'; leave time for the waiter to
+    // join the queue
+    std::this_thread::sleep_for(20ms);
+  }
+
+  lock.unlock();
+
+  for( auto& t : threads ) {
+    t.join();
+  }
+
+  REQUIRE( order == std::vector<int>{ 0, 1, 2, 3 } );
+}
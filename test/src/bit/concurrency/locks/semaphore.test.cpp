@@ -0,0 +1,107 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the semaphore
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/semaphore.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::semaphore;
+using namespace std::chrono_literals;
+
+//----------------------------------------------------------------------------
+// Waiting
+//----------------------------------------------------------------------------
+
+TEST_CASE("semaphore::try_wait()", "[locks][semaphore]")
+{
+  SECTION("A new semaphore has no count")
+  {
+    semaphore sem;
+
+    REQUIRE_FALSE( sem.try_wait() );
+  }
+
+  SECTION("Each wait takes one count")
+  {
+    semaphore sem{ 2 };
+
+    REQUIRE( sem.try_wait() );
+    REQUIRE( sem.try_wait() );
+    REQUIRE_FALSE( sem.try_wait() );
+  }
+
+  SECTION("Signal adds to the count")
+  {
+    semaphore sem;
+    sem.signal(3);
+
+    REQUIRE( sem.try_wait() );
+    REQUIRE( sem.try_wait() );
+    REQUIRE( sem.try_wait() );
+    REQUIRE_FALSE( sem.try_wait() );
+  }
+}
+
+TEST_CASE("semaphore::try_wait_for()", "[locks][semaphore]")
+{
+  semaphore sem;
+
+  SECTION("Times out without a count")
+  {
+    const auto start = std::chrono::steady_clock::now();
+
+    REQUIRE_FALSE( sem.try_wait_for(20ms) );
+    REQUIRE( std::chrono::steady_clock::now() - start >= 20ms );
+  }
+
+  SECTION("Wakes on a signal")
+  {
+    auto signaler = std::thread{[&]{
+      std::this_thread::sleep_for(10ms);
+      sem.signal();
+    }};
+
+    REQUIRE( sem.try_wait_for(10s) );
+
+    signaler.join();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("semaphore wakes as many waiters as it is signaled", "[locks][semaphore]")
+{
+  static constexpr auto waiters = 4;
+  static constexpr auto rounds = 200;
+
+  semaphore sem;
+  std::atomic<int> woken{ 0 };
+  auto threads = std::vector<std::thread>{};
+
+  for( auto t = 0; t < waiters; ++t ) {
+    threads.emplace_back([&]{
+      for( auto r = 0; r < rounds; ++r ) {
+        sem.wait();
+        woken.fetch_add(1);
+      }
+    });
+  }
+  for( auto r = 0; r < rounds; ++r ) {
+    sem.signal(waiters);
+  }
+  for( auto& t : threads ) {
+    t.join();
+  }
+
+  REQUIRE( woken == waiters * rounds );
+  REQUIRE_FALSE( sem.try_wait() );
+}
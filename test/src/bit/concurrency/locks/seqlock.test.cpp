@@ -0,0 +1,95 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the seqlock
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/seqlock.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::seqlock;
+
+namespace {
+
+  struct pair
+  {
+    long first;
+    long second;
+  };
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// Reading / Writing
+//----------------------------------------------------------------------------
+
+TEST_CASE("seqlock::store()", "[locks][seqlock]")
+{
+  seqlock<pair> lock{ pair{1, 2} };
+
+  SECTION("Loads the initial value")
+  {
+    const auto value = lock.load();
+
+    REQUIRE( value.first == 1 );
+    REQUIRE( value.second == 2 );
+  }
+
+  SECTION("Loads the stored value")
+  {
+    lock.store( pair{3, 4} );
+    const auto value = lock.load();
+
+    REQUIRE( value.first == 3 );
+    REQUIRE( value.second == 4 );
+  }
+
+  SECTION("Writes modify the current value")
+  {
+    lock.write([]( pair& p ){ p.second += 10; });
+    const auto value = lock.load();
+
+    REQUIRE( value.first == 1 );
+    REQUIRE( value.second == 12 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("seqlock readers never see a torn value", "[locks][seqlock]")
+{
+  static constexpr auto writers = 2;
+  static constexpr auto iterations = 5000;
+
+  seqlock<pair> lock{ pair{0, 0} };
+  std::atomic<int> done{ 0 };
+  std::atomic<int> torn{ 0 };
+  auto threads = std::vector<std::thread>{};
+
+  for( auto t = 0; t < writers; ++t ) {
+    threads.emplace_back([&]{
+      for( auto i = 0; i < iterations; ++i ) {
+        lock.write([]( pair& p ){ ++p.first; p.second = -p.first; });
+      }
+      done.fetch_add(1);
+    });
+  }
+  threads.emplace_back([&]{
+    while( done.load() != writers ) {
+      const auto value = lock.load();
+      if( value.first != -value.second ) torn.fetch_add(1);
+    }
+  });
+  for( auto& t : threads ) {
+    t.join();
+  }
+
+  REQUIRE( torn == 0 );
+  REQUIRE( lock.load().first == writers * iterations );
+}
@@ -0,0 +1,138 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the spin_lock
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/spin_lock.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::basic_spin_lock;
+using bit::concurrency::spin_lock;
+
+namespace {
+
+  /// A policy that counts how many times it has been constructed
+  class counting_backoff
+  {
+  public:
+    static std::atomic<int> constructed;
+
+    counting_backoff() noexcept
+    {
+      constructed.fetch_add(1);
+    }
+
+    void operator()() noexcept
+    {
+      std::this_thread::yield();
+    }
+  };
+
+  std::atomic<int> counting_backoff::constructed{ 0 };
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+TEST_CASE("spin_lock::try_lock()", "[locks][spin_lock]")
+{
+  spin_lock lock;
+
+  SECTION("An unlocked lock is acquired")
+  {
+    REQUIRE( lock.try_lock() );
+    lock.unlock();
+  }
+
+  SECTION("A held lock is not acquired")
+  {
+    lock.lock();
+
+    REQUIRE_FALSE( lock.try_lock() );
+    lock.unlock();
+  }
+
+  SECTION("A released lock is acquired again")
+  {
+    lock.lock();
+    lock.unlock();
+
+    REQUIRE( lock.try_lock() );
+    lock.unlock();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEMPLATE_TEST_CASE("basic_spin_lock excludes concurrent threads", "[locks][spin_lock]",
+                   bit::concurrency::pause_backoff,
+                   bit::concurrency::yield_backoff,
+                   bit::concurrency::spin_then_yield_backoff<>,
+                   bit::concurrency::exponential_backoff<>)
+{
+  static constexpr auto threads = 4;
+  static constexpr auto iterations = 5000;
+
+  basic_spin_lock<TestType> lock;
+  auto counter = 0;
+  auto workers = std::vector<std::thread>{};
+
+  for( auto t = 0; t < threads; ++t ) {
+    workers.emplace_back([&]{
+      for( auto i = 0; i < iterations; ++i ) {
+        std::lock_guard<basic_spin_lock<TestType>> guard{lock};
+        ++counter;
+      }
+    });
+  }
+  for( auto& w : workers ) {
+    w.join();
+  }
+
+  REQUIRE( counter == threads * iterations );
+}
+
+TEST_CASE("basic_spin_lock::lock() backs off with a fresh policy", "[locks][spin_lock]")
+{
+  basic_spin_lock<counting_backoff> lock;
+  counting_backoff::constructed.store(0);
+
+  SECTION("An uncontended lock constructs no policy")
+  {
+    lock.lock();
+    lock.unlock();
+
+    REQUIRE( counting_backoff::constructed.load() == 0 );
+  }
+
+  SECTION("Each contended lock constructs its own policy")
+  {
+    for( auto expected = 1; expected <= 2; ++expected ) {
+      lock.lock();
+
+      auto waiter = std::thread([&]{
+        lock.lock();
+        lock.unlock();
+      });
+
+      // The waiter only constructs a policy once it has found the lock held
+      while( counting_backoff::constructed.load() < expected ) {
+        std::this_thread::yield();
+      }
+      lock.unlock();
+      waiter.join();
+
+      REQUIRE( counting_backoff::constructed.load() == expected );
+    }
+  }
+}
@@ -0,0 +1,121 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the striped_lock
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/striped_lock.hpp>
+#include <bit/concurrency/locks/spin_lock.hpp>
+
+#include <catch.hpp>
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::striped_lock;
+using bit::concurrency::spin_lock;
+
+//----------------------------------------------------------------------------
+// Stripes
+//----------------------------------------------------------------------------
+
+TEST_CASE("striped_lock::stripe_for()", "[locks][striped_lock]")
+{
+  striped_lock<spin_lock,16> locks;
+
+  SECTION("Has the requested number of stripes")
+  {
+    REQUIRE( locks.size() == 16u );
+  }
+
+  SECTION("A key always maps to the same stripe")
+  {
+    REQUIRE( locks.index_for(42) == locks.index_for(42) );
+    REQUIRE( locks.index_for(42) < locks.size() );
+    REQUIRE( &locks.stripe_for(42) == &locks.stripe(locks.index_for(42)) );
+  }
+
+  SECTION("A key maps to the stripe of its hash")
+  {
+    const auto hash = std::hash<int>{}(42);
+
+    REQUIRE( locks.index_for(42) == locks.index_for_hash(hash) );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Locking
+//----------------------------------------------------------------------------
+
+TEST_CASE("striped_lock::lock_many()", "[locks][striped_lock]")
+{
+  striped_lock<spin_lock,16> locks;
+
+  SECTION("Locks the stripe of every key")
+  {
+    locks.lock_many(1, 2, 3);
+
+    REQUIRE_FALSE( locks.stripe_for(1).try_lock() );
+    REQUIRE_FALSE( locks.stripe_for(2).try_lock() );
+    REQUIRE_FALSE( locks.stripe_for(3).try_lock() );
+
+    locks.unlock_many(1, 2, 3);
+
+    REQUIRE( locks.stripe_for(1).try_lock() );
+    locks.stripe_for(1).unlock();
+  }
+
+  SECTION("Keys that share a stripe lock it once")
+  {
+    locks.lock_many(7, 7);
+    locks.unlock_many(7, 7);
+
+    REQUIRE( locks.stripe_for(7).try_lock() );
+    locks.stripe_for(7).unlock();
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("striped_lock guarding transfers", "[locks][striped_lock]")
+{
+  static constexpr auto accounts = 8;
+  static constexpr auto threads = 4;
+  static constexpr auto iterations = 2000;
+
+  striped_lock<spin_lock,4> locks;
+  int balances[accounts] = {};
+  int transfers[accounts] = {};
+  auto workers = std::vector<std::thread>{};
+
+  // Transfers between pairs of accounts, taking both stripes in either
+  // order, would deadlock or lose updates if the locking were wrong
+  for( auto t = 0; t < threads; ++t ) {
+    workers.emplace_back([&,t]{
+      for( auto i = 0; i < iterations; ++i ) {
+        const auto from = (t + i) % accounts;
+        const auto to = (t * 3 + i * 5 + 1) % accounts;
+
+        locks.lock_many(from, to);
+        --balances[from];
+        ++balances[to];
+        ++transfers[from];
+        locks.unlock_many(from, to);
+      }
+    });
+  }
+  for( auto& w : workers ) {
+    w.join();
+  }
+
+  auto total = 0;
+  auto count = 0;
+  for( auto i = 0; i < accounts; ++i ) {
+    total += balances[i];
+    count += transfers[i];
+  }
+  REQUIRE( total == 0 );
+  REQUIRE( count == threads * iterations );
+}
@@ -0,0 +1,236 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the waitable_event
+ *****************************************************************************/
+
+#include <bit/concurrency/locks/waitable_event.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#if defined(__linux__)
+# include <sys/resource.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+using bit::concurrency::waitable_event;
+using namespace std::chrono_literals;
+
+namespace {
+
+  void lower_this_thread_priority()
+  {
+#if defined(__linux__)
+    ::setpriority( PRIO_PROCESS, static_cast<id_t>(::syscall(SYS_gettid)), 19 );
+#endif
+  }
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// Automatic Reset
+//----------------------------------------------------------------------------
+
+TEST_CASE("waitable_event::signal() with automatic reset", "[locks][waitable_event]")
+{
+  waitable_event event{ waitable_event::reset_mode::automatic };
+
+  SECTION("A new event is not signaled")
+  {
+    REQUIRE_FALSE( event.try_wait() );
+  }
+
+  SECTION("A signal is consumed by a single wait")
+  {
+    event.signal();
+
+    REQUIRE( event.try_wait() );
+    REQUIRE_FALSE( event.try_wait() );
+  }
+
+  SECTION("Signaling twice leaves one signal")
+  {
+    event.signal();
+    event.signal();
+
+    REQUIRE( event.try_wait() );
+    REQUIRE_FALSE( event.try_wait() );
+  }
+
+  SECTION("Reset discards the signal")
+  {
+    event.signal();
+    event.reset();
+
+    REQUIRE_FALSE( event.try_wait() );
+  }
+
+  SECTION("A timed wait on an unsignaled event times out")
+  {
+    REQUIRE_FALSE( event.wait_for( 10ms ) );
+    REQUIRE_FALSE( event.try_wait() );
+  }
+
+  SECTION("A timed wait consumes a pending signal")
+  {
+    event.signal();
+
+    REQUIRE( event.wait_for( 10ms ) );
+    REQUIRE_FALSE( event.try_wait() );
+  }
+}
+
+TEST_CASE("waitable_event::signal() with automatic reset wakes one waiter per signal", "[locks][waitable_event]")
+{
+  constexpr auto waiters = 4;
+
+  waitable_event event{ waitable_event::reset_mode::automatic };
+  std::atomic<int> woken{ 0 };
+  std::thread threads[waiters];
+
+  for( auto& t : threads ) {
+    t = std::thread([&]{
+      event.wait();
+      woken.fetch_add(1);
+    });
+  }
+
+  for( auto i = 0; i < waiters; ++i ) {
+    event.signal();
+
+    while( woken.load() != i + 1 ) {
+      std::this_thread::yield();
+    }
+  }
+
+  for( auto& t : threads ) {
+    t.join();
+  }
+
+  REQUIRE( woken.load() == waiters );
+  REQUIRE_FALSE( event.try_wait() );
+}
+
+//----------------------------------------------------------------------------
+// Manual Reset
+//----------------------------------------------------------------------------
+
+TEST_CASE("waitable_event::signal() with manual reset", "[locks][waitable_event]")
+{
+  waitable_event event{ waitable_event::reset_mode::manual };
+
+  SECTION("The event stays signaled until reset")
+  {
+    event.signal();
+
+    REQUIRE( event.try_wait() );
+    REQUIRE( event.try_wait() );
+    REQUIRE( event.wait_for( 10ms ) );
+
+    event.reset();
+
+    REQUIRE_FALSE( event.try_wait() );
+    REQUIRE_FALSE( event.wait_for( 10ms ) );
+  }
+}
+
+TEST_CASE("waitable_event::signal() with manual reset wakes every waiter", "[locks][waitable_event]")
+{
+  constexpr auto waiters = 4;
+
+  waitable_event event{ waitable_event::reset_mode::manual };
+  std::atomic<int> woken{ 0 };
+  std::thread threads[waiters];
+
+  for( auto& t : threads ) {
+    t = std::thread([&]{
+      event.wait();
+      woken.fetch_add(1);
+    });
+  }
+
+  event.signal();
+
+  for( auto& t : threads ) {
+    t.join();
+  }
+
+  REQUIRE( woken.load() == waiters );
+}
+
+TEST_CASE("waitable_event::reset() after a signal releases only the signaled generation", "[locks][waitable_event]")
+{
+  // A waiter parks, and the event is pulsed with signal() and reset(). A
+  // waiter that arrives after the reset must not take the permit that was
+  // posted for the first, which must still return before timing out. The
+  // first waiter runs at a low priority, so that its wakeup does not preempt
+  // the pulse on a single core.
+  waitable_event event{ waitable_event::reset_mode::manual };
+  std::atomic<bool> parked{ false };
+  auto released = false;
+  auto elapsed = std::chrono::steady_clock::duration();
+
+  auto first = std::thread([&]{
+    lower_this_thread_priority();
+    parked.store(true);
+
+    const auto start = std::chrono::steady_clock::now();
+    released = event.wait_for( 300ms );
+    elapsed = std::chrono::steady_clock::now() - start;
+  });
+
+  while( !parked.load() ) {
+    std::this_thread::yield();
+  }
+  std::this_thread::sleep_for( 20ms );
+
+  event.signal();
+  event.reset();
+
+  const auto late = event.wait_for( 50ms );
+
+  // Releases the first waiter if its permit was lost, rather than hanging
+  event.signal();
+  first.join();
+
+  REQUIRE_FALSE( late );
+  REQUIRE( released );
+  REQUIRE( elapsed < 300ms );
+}
+
+TEST_CASE("waitable_event::signal() with manual reset releases every generation", "[locks][waitable_event]")
+{
+  // Waiters keep registering while the event is pulsed, so waiters of many
+  // generations are parked at once; each must return from its own pulse
+  constexpr auto waiters = 4;
+  constexpr auto rounds = 100;
+
+  waitable_event event{ waitable_event::reset_mode::manual };
+  std::atomic<int> finished{ 0 };
+  std::thread threads[waiters];
+
+  for( auto& t : threads ) {
+    t = std::thread([&]{
+      for( auto i = 0; i < rounds; ++i ) {
+        event.wait();
+      }
+      finished.fetch_add(1);
+    });
+  }
+
+  while( finished.load() != waiters ) {
+    event.signal();
+    std::this_thread::yield();
+    event.reset();
+  }
+
+  for( auto& t : threads ) {
+    t.join();
+  }
+
+  REQUIRE( finished.load() == waiters );
+}
@@ -0,0 +1,184 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the epoch_domain
+ *****************************************************************************/
+
+#include <bit/concurrency/memory/epoch_domain.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::epoch_domain;
+
+namespace {
+
+  struct node
+  {
+    explicit node( std::atomic<int>& live, long value = 0 )
+      : live(live), value(value), next(nullptr)
+    {
+      live.fetch_add(1);
+    }
+
+    ~node()
+    {
+      live.fetch_sub(1);
+    }
+
+    std::atomic<int>& live;
+    long              value;
+    node*             next;
+  };
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// Critical Regions
+//----------------------------------------------------------------------------
+
+TEST_CASE("epoch_domain::participant::enter()", "[memory][epoch_domain]")
+{
+  epoch_domain domain;
+  epoch_domain::participant p{ domain };
+
+  SECTION("A new participant is outside any critical region")
+  {
+    REQUIRE_FALSE( p.in_critical_region() );
+  }
+
+  SECTION("Critical regions nest")
+  {
+    p.enter();
+    p.enter();
+    p.exit();
+    REQUIRE( p.in_critical_region() );
+    p.exit();
+    REQUIRE_FALSE( p.in_critical_region() );
+  }
+
+  SECTION("A guard enters and exits a critical region")
+  {
+    {
+      epoch_domain::guard g{ p };
+      REQUIRE( p.in_critical_region() );
+    }
+    REQUIRE_FALSE( p.in_critical_region() );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Reclamation
+//----------------------------------------------------------------------------
+
+TEST_CASE("epoch_domain::participant::retire()", "[memory][epoch_domain]")
+{
+  std::atomic<int> live{ 0 };
+
+  SECTION("Retired nodes are deleted once collected")
+  {
+    epoch_domain domain{ 1 };
+    epoch_domain::participant p{ domain };
+
+    for( auto i = 0; i < 10; ++i ) {
+      p.retire( new node(live) );
+    }
+    for( auto i = 0; i < 4; ++i ) {
+      p.collect();
+    }
+
+    REQUIRE( live == 0 );
+  }
+
+  SECTION("A critical region keeps retired nodes alive")
+  {
+    epoch_domain domain{ 1 };
+    epoch_domain::participant reader{ domain };
+    epoch_domain::participant writer{ domain };
+
+    reader.enter();
+    writer.retire( new node(live) );
+    for( auto i = 0; i < 4; ++i ) {
+      writer.collect();
+    }
+    REQUIRE( live == 1 );
+
+    reader.exit();
+    for( auto i = 0; i < 4; ++i ) {
+      writer.collect();
+    }
+    REQUIRE( live == 0 );
+  }
+
+  SECTION("Nodes still retired are deleted with the domain")
+  {
+    {
+      epoch_domain domain;
+      epoch_domain::participant p{ domain };
+
+      p.retire( new node(live) );
+      p.retire( new node(live) );
+    }
+
+    REQUIRE( live == 0 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("epoch_domain guarding a lock-free stack", "[memory][epoch_domain]")
+{
+  static constexpr auto threads = 4;
+  static constexpr auto iterations = 3000;
+
+  std::atomic<int> live{ 0 };
+  std::atomic<int> corrupt{ 0 };
+  std::atomic<node*> head{ nullptr };
+
+  {
+    epoch_domain domain{ 16 };
+    auto workers = std::vector<std::thread>{};
+
+    for( auto t = 0; t < threads; ++t ) {
+      workers.emplace_back([&]{
+        epoch_domain::participant p{ domain };
+
+        for( auto i = 0; i < iterations; ++i ) {
+          if( i % 2 == 0 ) {
+            auto* n = new node(live, 42);
+            n->next = head.load();
+            while( !head.compare_exchange_weak(n->next, n) ) {}
+            continue;
+          }
+
+          epoch_domain::guard g{ p };
+          auto* n = head.load();
+          // Reading 'n->next' of a node another thread popped is only safe
+          // while the node has not been deleted
+          while( n != nullptr && !head.compare_exchange_weak(n, n->next) ) {}
+          if( n != nullptr ) {
+            if( n->value != 42 ) corrupt.fetch_add(1);
+            p.retire(n);
+          }
+        }
+      });
+    }
+    for( auto& w : workers ) {
+      w.join();
+    }
+
+    auto* n = head.exchange(nullptr);
+    while( n != nullptr ) {
+      auto* next = n->next;
+      delete n;
+      n = next;
+    }
+  }
+
+  REQUIRE( corrupt == 0 );
+  REQUIRE( live == 0 );
+}
@@ -0,0 +1,171 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the hazard_pointer_domain
+ *****************************************************************************/
+
+#include <bit/concurrency/memory/hazard_pointer_domain.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::hazard_pointer_domain;
+
+namespace {
+
+  struct node
+  {
+    explicit node( std::atomic<int>& live, long value = 0 )
+      : live(live), value(value), next(nullptr)
+    {
+      live.fetch_add(1);
+    }
+
+    ~node()
+    {
+      live.fetch_sub(1);
+    }
+
+    std::atomic<int>& live;
+    long              value;
+    node*             next;
+  };
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// Observers
+//----------------------------------------------------------------------------
+
+TEST_CASE("hazard_pointer_domain::hazards()", "[memory][hazard_pointer_domain]")
+{
+  hazard_pointer_domain domain{ 3 };
+
+  REQUIRE( domain.hazards() == 3u );
+}
+
+//----------------------------------------------------------------------------
+// Reclamation
+//----------------------------------------------------------------------------
+
+TEST_CASE("hazard_pointer_domain::participant::retire()", "[memory][hazard_pointer_domain]")
+{
+  std::atomic<int> live{ 0 };
+
+  SECTION("Unprotected nodes are deleted once collected")
+  {
+    hazard_pointer_domain domain;
+    hazard_pointer_domain::participant p{ domain };
+
+    for( auto i = 0; i < 10; ++i ) {
+      p.retire( new node(live) );
+    }
+    p.collect();
+
+    REQUIRE( live == 0 );
+  }
+
+  SECTION("A protected node is kept until its hazard is cleared")
+  {
+    hazard_pointer_domain domain;
+    hazard_pointer_domain::participant reader{ domain };
+    hazard_pointer_domain::participant writer{ domain };
+
+    std::atomic<node*> source{ new node(live) };
+    auto* protected_node = reader.protect(0, source);
+    REQUIRE( protected_node == source.load() );
+
+    writer.retire( source.exchange(nullptr) );
+    writer.collect();
+    REQUIRE( live == 1 );
+
+    reader.clear(0);
+    writer.collect();
+    REQUIRE( live == 0 );
+  }
+
+  SECTION("Protecting a null pointer protects nothing")
+  {
+    hazard_pointer_domain domain;
+    hazard_pointer_domain::participant p{ domain };
+    std::atomic<node*> source{ nullptr };
+
+    REQUIRE( p.protect(0, source) == nullptr );
+  }
+
+  SECTION("Nodes still retired are deleted with the domain")
+  {
+    {
+      hazard_pointer_domain domain;
+      hazard_pointer_domain::participant reader{ domain };
+      hazard_pointer_domain::participant writer{ domain };
+      auto* n = new node(live);
+
+      reader.set(0, n);
+      writer.retire(n);
+      writer.collect();
+      REQUIRE( live == 1 );
+    }
+
+    REQUIRE( live == 0 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("hazard_pointer_domain guarding a lock-free stack", "[memory][hazard_pointer_domain]")
+{
+  static constexpr auto threads = 4;
+  static constexpr auto iterations = 3000;
+
+  std::atomic<int> live{ 0 };
+  std::atomic<int> corrupt{ 0 };
+  std::atomic<node*> head{ nullptr };
+
+  {
+    hazard_pointer_domain domain{ 1 };
+    auto workers = std::vector<std::thread>{};
+
+    for( auto t = 0; t < threads; ++t ) {
+      workers.emplace_back([&]{
+        hazard_pointer_domain::participant p{ domain };
+
+        for( auto i = 0; i < iterations; ++i ) {
+          if( i % 2 == 0 ) {
+            auto* n = new node(live, 42);
+            n->next = head.load();
+            while( !head.compare_exchange_weak(n->next, n) ) {}
+            continue;
+          }
+
+          auto* n = p.protect(0, head);
+          while( n != nullptr && !head.compare_exchange_strong(n, n->next) ) {
+            n = p.protect(0, head);
+          }
+          p.clear(0);
+          if( n != nullptr ) {
+            if( n->value != 42 ) corrupt.fetch_add(1);
+            p.retire(n);
+          }
+        }
+      });
+    }
+    for( auto& w : workers ) {
+      w.join();
+    }
+
+    auto* n = head.exchange(nullptr);
+    while( n != nullptr ) {
+      auto* next = n->next;
+      delete n;
+      n = next;
+    }
+  }
+
+  REQUIRE( corrupt == 0 );
+  REQUIRE( live == 0 );
+}
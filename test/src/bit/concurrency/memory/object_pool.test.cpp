@@ -0,0 +1,144 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the object_pool
+ *****************************************************************************/
+
+#include <bit/concurrency/memory/object_pool.hpp>
+
+#include <catch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::object_pool;
+
+namespace {
+
+  struct tracked
+  {
+    explicit tracked( std::atomic<int>& live, int value = 0 )
+      : live(live), value(value)
+    {
+      live.fetch_add(1);
+    }
+
+    ~tracked()
+    {
+      live.fetch_sub(1);
+    }
+
+    std::atomic<int>& live;
+    int               value;
+  };
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// Allocation
+//----------------------------------------------------------------------------
+
+TEST_CASE("object_pool::allocate()", "[memory][object_pool]")
+{
+  object_pool<std::uint64_t,4> pool{ 8 };
+
+  SECTION("Live allocations are distinct and aligned")
+  {
+    auto pointers = std::set<void*>{};
+    for( auto i = 0; i < 100; ++i ) {
+      auto* p = pool.allocate();
+      REQUIRE( reinterpret_cast<std::uintptr_t>(p) % alignof(std::uint64_t) == 0u );
+      pointers.insert(p);
+    }
+    REQUIRE( pointers.size() == 100u );
+
+    for( auto* p : pointers ) {
+      pool.deallocate(p);
+    }
+  }
+
+  SECTION("Deallocated storage is reused")
+  {
+    auto* p = pool.allocate();
+    pool.deallocate(p);
+
+    REQUIRE( pool.allocate() == p );
+  }
+}
+
+TEST_CASE("object_pool::construct()", "[memory][object_pool]")
+{
+  std::atomic<int> live{ 0 };
+  object_pool<tracked> pool;
+
+  SECTION("Constructs the object from the arguments")
+  {
+    auto* p = pool.construct(live, 5);
+
+    REQUIRE( p->value == 5 );
+    REQUIRE( live == 1 );
+
+    pool.destroy(p);
+    REQUIRE( live == 0 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("object_pool with concurrent threads", "[memory][object_pool]")
+{
+  static constexpr auto threads = 4;
+  static constexpr auto rounds = 200;
+  static constexpr auto batch = 20;
+
+  std::atomic<int> live{ 0 };
+  std::atomic<int> corrupt{ 0 };
+  object_pool<tracked,8> pool{ 16 };
+  auto handoff = std::vector<std::vector<tracked*>>(threads);
+  auto workers = std::vector<std::thread>{};
+
+  // Each thread frees half of its objects itself, and leaves the other
+  // half to its neighbour, so objects also move between thread caches
+  for( auto t = 0; t < threads; ++t ) {
+    workers.emplace_back([&,t]{
+      auto owned = std::vector<tracked*>{};
+      for( auto r = 0; r < rounds; ++r ) {
+        for( auto i = 0; i < batch; ++i ) {
+          owned.push_back(pool.construct(live, t));
+        }
+        for( auto* p : owned ) {
+          if( p->value != t ) corrupt.fetch_add(1);
+        }
+        for( auto i = 0; i < batch / 2; ++i ) {
+          pool.destroy(owned.back());
+          owned.pop_back();
+        }
+      }
+      handoff[t] = std::move(owned);
+    });
+  }
+  for( auto& w : workers ) {
+    w.join();
+  }
+  workers.clear();
+
+  for( auto t = 0; t < threads; ++t ) {
+    workers.emplace_back([&,t]{
+      for( auto* p : handoff[(t + 1) % threads] ) {
+        if( p->value != (t + 1) % threads ) corrupt.fetch_add(1);
+        pool.destroy(p);
+      }
+    });
+  }
+  for( auto& w : workers ) {
+    w.join();
+  }
+
+  REQUIRE( corrupt == 0 );
+  REQUIRE( live == 0 );
+}
@@ -0,0 +1,72 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the backoff policies
+ *****************************************************************************/
+
+#include <bit/concurrency/utilities/backoff.hpp>
+
+#include <catch.hpp>
+
+#include <cstddef>
+
+using bit::concurrency::exponential_backoff;
+
+//----------------------------------------------------------------------------
+// Backoff
+//----------------------------------------------------------------------------
+
+TEST_CASE("exponential_backoff::operator()()", "[utilities][backoff]")
+{
+  SECTION("Starts from the minimum")
+  {
+    exponential_backoff<3,64> backoff;
+
+    REQUIRE( backoff.pauses() == 3u );
+  }
+
+  SECTION("Doubles the pauses on each attempt")
+  {
+    exponential_backoff<1,64> backoff;
+
+    backoff();
+    REQUIRE( backoff.pauses() == 2u );
+
+    backoff();
+    REQUIRE( backoff.pauses() == 4u );
+  }
+
+  SECTION("Never pauses more than the maximum")
+  {
+    exponential_backoff<1,8> backoff;
+
+    for( auto i = 0; i < 16; ++i ) {
+      REQUIRE( backoff.pauses() <= 8u );
+      backoff();
+    }
+  }
+
+  SECTION("Yields once the maximum is passed")
+  {
+    exponential_backoff<1,8> backoff;
+
+    for( auto i = 0; i < 4; ++i ) {
+      backoff();
+    }
+    REQUIRE( backoff.pauses() == 0u );
+
+    backoff();
+    REQUIRE( backoff.pauses() == 0u );
+  }
+
+  SECTION("A fresh policy starts again from the minimum")
+  {
+    exponential_backoff<1,8> backoff;
+
+    for( auto i = 0; i < 8; ++i ) {
+      backoff();
+    }
+    backoff = exponential_backoff<1,8>();
+
+    REQUIRE( backoff.pauses() == 1u );
+  }
+}
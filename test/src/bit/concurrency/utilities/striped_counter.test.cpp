@@ -0,0 +1,91 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the striped_counter
+ *****************************************************************************/
+
+#include <bit/concurrency/utilities/striped_counter.hpp>
+
+#include <catch.hpp>
+
+#include <thread>
+#include <vector>
+
+using bit::concurrency::striped_counter;
+
+//----------------------------------------------------------------------------
+// Updates
+//----------------------------------------------------------------------------
+
+TEST_CASE("striped_counter::add()", "[utilities][striped_counter]")
+{
+  SECTION("A new counter is zero")
+  {
+    striped_counter counter;
+
+    REQUIRE( counter.read() == 0 );
+    REQUIRE( counter.cells() == 0u );
+  }
+
+  SECTION("Starts from the initial value")
+  {
+    striped_counter counter{ 5 };
+
+    REQUIRE( counter.read() == 5 );
+  }
+
+  SECTION("Updates are summed")
+  {
+    striped_counter counter;
+
+    counter.add(10);
+    counter.sub(3);
+    counter.increment();
+    counter.increment();
+    counter.decrement();
+
+    REQUIRE( counter.read() == 8 );
+  }
+
+  SECTION("Reset sets the counter to zero")
+  {
+    striped_counter counter{ 5 };
+    counter.reset();
+
+    REQUIRE( counter.read() == 0 );
+  }
+
+  SECTION("Reading and resetting returns the sum")
+  {
+    striped_counter counter{ 5 };
+    counter.add(2);
+
+    REQUIRE( counter.read_and_reset() == 7 );
+    REQUIRE( counter.read() == 0 );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("striped_counter with concurrent updates", "[utilities][striped_counter]")
+{
+  static constexpr auto threads = 4;
+  static constexpr auto iterations = 20000;
+
+  striped_counter counter;
+  auto workers = std::vector<std::thread>{};
+
+  for( auto t = 0; t < threads; ++t ) {
+    workers.emplace_back([&]{
+      for( auto i = 0; i < iterations; ++i ) {
+        counter.increment();
+      }
+    });
+  }
+  for( auto& w : workers ) {
+    w.join();
+  }
+
+  REQUIRE( counter.read() == threads * iterations );
+}
@@ -0,0 +1,124 @@
+/*****************************************************************************
+ * \file
+ * \brief Unit tests for the striped_storage, per_thread and per_cpu
+ *****************************************************************************/
+
+#include <bit/concurrency/utilities/striped_storage.hpp>
+#include <bit/concurrency/utilities/per_cpu.hpp>
+#include <bit/concurrency/utilities/per_thread.hpp>
+
+#include <catch.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using bit::concurrency::per_cpu;
+using bit::concurrency::per_thread;
+using bit::concurrency::striped_storage;
+
+namespace {
+
+  struct fixed_index
+  {
+    static std::size_t index() noexcept{ return 5; }
+  };
+
+} // namespace
+
+//----------------------------------------------------------------------------
+// Element Access
+//----------------------------------------------------------------------------
+
+TEST_CASE("striped_storage::local()", "[utilities][striped_storage]")
+{
+  striped_storage<int,fixed_index,4> storage;
+
+  SECTION("Every slot is value-initialized")
+  {
+    REQUIRE( std::accumulate(storage.begin(), storage.end(), 0) == 0 );
+  }
+
+  SECTION("The index is taken modulo the number of slots")
+  {
+    storage.local() = 3;
+
+    REQUIRE( &storage.local() == &storage[1] );
+    REQUIRE( storage[1] == 3 );
+  }
+
+  SECTION("Iterating visits every slot")
+  {
+    for( auto i = 0u; i < storage.size(); ++i ) {
+      storage[i] = static_cast<int>(i + 1);
+    }
+
+    REQUIRE( std::accumulate(storage.begin(), storage.end(), 0) == 10 );
+  }
+
+  SECTION("Slots are on separate cache lines")
+  {
+    const auto distance = reinterpret_cast<std::uintptr_t>(&storage[1]) -
+                          reinterpret_cast<std::uintptr_t>(&storage[0]);
+
+    REQUIRE( distance >= bit::concurrency::cache_line_size );
+  }
+}
+
+TEST_CASE("per_thread::local()", "[utilities][per_thread]")
+{
+  per_thread<int,64> storage;
+
+  SECTION("A thread always gets the same slot")
+  {
+    REQUIRE( &storage.local() == &storage.local() );
+  }
+
+  SECTION("A thread gets the slot of its index")
+  {
+    const auto index = bit::concurrency::this_thread_index() % storage.size();
+
+    REQUIRE( &storage.local() == &storage[index] );
+  }
+
+  SECTION("Each thread has its own index")
+  {
+    auto other = std::size_t(0);
+    auto thread = std::thread{[&]{ other = bit::concurrency::this_thread_index(); }};
+    thread.join();
+
+    REQUIRE( other != bit::concurrency::this_thread_index() );
+  }
+}
+
+//----------------------------------------------------------------------------
+// Concurrency
+//----------------------------------------------------------------------------
+
+TEST_CASE("per_cpu with concurrent updates", "[utilities][per_cpu]")
+{
+  static constexpr auto threads = 4;
+  static constexpr auto iterations = 20000;
+
+  per_cpu<std::atomic<long>,8> storage;
+  auto workers = std::vector<std::thread>{};
+
+  for( auto t = 0; t < threads; ++t ) {
+    workers.emplace_back([&]{
+      for( auto i = 0; i < iterations; ++i ) {
+        storage.local().fetch_add(1, std::memory_order_relaxed);
+      }
+    });
+  }
+  for( auto& w : workers ) {
+    w.join();
+  }
+
+  auto total = 0l;
+  for( auto& slot : storage ) {
+    total += slot.load();
+  }
+  REQUIRE( total == threads * iterations );
+}